@@ -0,0 +1,186 @@
+#include <iostream>
+#include <string>
+#include <iomanip>
+#include <algorithm>
+#include <cstdint>
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <thread>
+#include <type_traits>
+
+#include "pathlab/core/csr_graph.hpp"
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/algorithms/search_context.hpp"
+#include "pathlab/algorithms/dijkstra.hpp"
+#include "pathlab/algorithms/dijkstra_po.hpp"
+#include "pathlab/queues/binary_heap.hpp"
+#include "pathlab/queues/po_queue.hpp"
+#include "pathlab/queues/adaptive_po_queue.hpp"
+#include "pathlab/queues/radix_heap.hpp"
+#include "pathlab/queues/indexed_dary_heap.hpp"
+#include "pathlab/util/thread_pool.hpp"
+#include "pathlab/dmm/sssp.hpp"
+
+// 명시적 그래프(CSR) 벤치: DIMACS .gr 또는 격자 .map(→ CsrGraph::from_grid)에서
+// 무작위 노드 쌍 질의를 Dijkstra / DijkstraPO / dmm::SSSP로 푼다 (격자와 같은 엔진).
+
+static inline bool eq(const std::string& a, const char* b) {
+    return a == b;
+}
+
+static bool ends_with(const std::string& s, const char* suf) {
+    const size_t n = std::char_traits<char>::length(suf);
+    return s.size() >= n && s.compare(s.size() - n, n, suf) == 0;
+}
+
+// 큐 이름 → 타입 디스패치: f(std::type_identity<Queue>{})
+template <class F>
+static void with_queue(const std::string& q, F&& f) {
+    if      (q == "po")    f(std::type_identity<pathlab::POQueue<int, 1000000ULL, 256, 256ULL>>{});
+    else if (q == "apo")   f(std::type_identity<pathlab::AdaptivePOQueue<int>>{});
+    else if (q == "radix") f(std::type_identity<pathlab::RadixHeap<int>>{});
+    else if (q == "dary")  f(std::type_identity<pathlab::IndexedDaryHeap<int,double,4>>{});
+    else                   f(std::type_identity<pathlab::BinaryHeap<int,double>>{});
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::cerr
+          << "usage: bench_graph <graph.gr | map_file> [--algo A] [--queue Q] [--dmm-ds D] [--queries N] [--seed S]\n"
+          << "       [--no-diag] [--threads N] [--verify] [--print N]\n"
+          << "  A: dijkstra|dijkstra-po|dmm|dmm-legacy (default: dijkstra, dijkstra-po는 --queue 없으면 po)\n"
+          << "  Q: heap|po|apo|radix|dary (default: heap)\n"
+          << "  D: efficient|adaptive (BMSSP의 D 구조)\n"
+          << "  .gr(DIMACS)가 아니면 격자 맵으로 읽어 CSR로 변환 (--no-diag면 4방)\n"
+          << "  --queries N: 무작위 (s,t) 쌍 수 (default 1000), --seed S (default 1)\n"
+          << "  --verify: 힙 Dijkstra 비용과 비교해 불일치 수 출력\n";
+        return 1;
+    }
+    std::string path = argv[1];
+
+    // ---- 옵션 파싱 ----
+    std::string algo = "dijkstra";
+    std::string qname = "heap";
+    bool queue_set = false;
+    std::string dmm_ds = "efficient";
+    size_t n_queries = 1000;
+    uint64_t seed = 1;
+    bool allow_diag = true;
+    bool verify = false;
+    size_t print_first = 5;
+    unsigned n_threads = 1;
+
+    for (int i = 2; i < argc; ++i) {
+        std::string a = argv[i];
+        if      (eq(a, "--algo") && i+1 < argc)    { algo = argv[++i]; }
+        else if (eq(a, "--queue") && i+1 < argc)   { qname = argv[++i]; queue_set = true; }
+        else if (eq(a, "--dmm-ds") && i+1 < argc)  { dmm_ds = argv[++i]; }
+        else if (eq(a, "--queries") && i+1 < argc) { n_queries = std::stoul(argv[++i]); }
+        else if (eq(a, "--seed") && i+1 < argc)    { seed = std::stoull(argv[++i]); }
+        else if (eq(a, "--print") && i+1 < argc)   { print_first = std::stoul(argv[++i]); }
+        else if (eq(a, "--threads") && i+1 < argc) { n_threads = (unsigned)std::stoul(argv[++i]); }
+        else if (eq(a, "--no-diag")) allow_diag = false;
+        else if (eq(a, "--verify"))  verify = true;
+    }
+    if (algo == "dijkstra-po" && !queue_set) qname = "po";
+    if (n_threads == 0) n_threads = std::max(1u, std::thread::hardware_concurrency());
+
+    // ---- 로드 ----
+    pathlab::CsrGraph graph;
+    const auto load_t0 = std::chrono::steady_clock::now();
+    if (ends_with(path, ".gr")) {
+        if (!graph.load_dimacs(path)) { std::cerr << "Failed to load graph: " << path << "\n"; return 1; }
+    } else {
+        pathlab::GridMap map;
+        if (!map.load_from_file(path)) { std::cerr << "Failed to load map: " << path << "\n"; return 1; }
+        graph = pathlab::CsrGraph::from_grid(map, allow_diag);
+    }
+    const double load_ms =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - load_t0).count();
+    const uint32_t n = graph.node_count();
+    std::cout << "Graph: nodes=" << n << " edges=" << graph.edge_count()
+              << (graph.is_grid() ? " (grid)" : " (dimacs)") << " load_ms=" << load_ms << "\n";
+    if (n == 0) return 1;
+
+    // ---- 질의 (시드 고정) ----
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<uint32_t> pick(0, n - 1);
+    std::vector<std::pair<int,int>> queries(n_queries);
+    for (auto& q : queries) q = { (int)pick(rng), (int)pick(rng) };
+
+    pathlab::ThreadPool pool(n_threads);
+    std::vector<pathlab::SearchContext> ctxs(pool.size());
+    std::vector<pathlab::PathResult> results(n_queries);
+
+    const auto wall_t0 = std::chrono::steady_clock::now();
+    auto run_all = [&](auto&& solve_one) {
+        pool.parallel_for(n_queries, /*grain=*/4, [&](unsigned w, size_t i) {
+            results[i] = solve_one(w, queries[i].first, queries[i].second);
+        });
+    };
+
+    if (algo == "dmm" || algo == "dmm-legacy") {
+        pathlab::dmm::SSSP::Params P;
+        P.legacy = algo == "dmm-legacy";
+        P.adaptive_ds = (dmm_ds == "adaptive");
+        std::vector<pathlab::dmm::SSSP> algs(pool.size(), pathlab::dmm::SSSP(P));
+        run_all([&](unsigned w, int s, int t) { return algs[w].solve(ctxs[w], graph, s, t); });
+    } else {
+        with_queue(qname, [&](auto qt) {
+            using Q = typename decltype(qt)::type;
+            std::vector<pathlab::DijkstraT<Q>> algs(pool.size());
+            run_all([&](unsigned w, int s, int t) { return algs[w].solve(ctxs[w], graph, s, t); });
+        });
+    }
+    const double wall_ms =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wall_t0).count();
+
+    // ---- 누적/요약 ----
+    size_t solved = 0;
+    double sum_cost = 0.0, sum_ms = 0.0;
+    uint64_t sum_expanded = 0, sum_pushes = 0, sum_pops = 0;
+    for (size_t i = 0; i < n_queries; ++i) {
+        const pathlab::PathResult& res = results[i];
+        if (res.found) { ++solved; sum_cost += res.cost; }
+        sum_ms       += res.stats.millis;
+        sum_expanded += res.stats.expanded;
+        sum_pushes   += res.stats.pushes;
+        sum_pops     += res.stats.pops;
+        if (i < print_first) {
+            std::cout << "Query[" << i << "] " << queries[i].first << "->" << queries[i].second << " "
+                      << (res.found ? "FOUND" : "FAIL")
+                      << " cost="     << std::fixed << std::setprecision(3) << res.cost
+                      << " expanded=" << res.stats.expanded
+                      << " time_ms="  << res.stats.millis
+                      << "\n";
+        }
+    }
+    const size_t q = n_queries;
+    std::cout << "\nSummary (" << solved << "/" << q << " solved)"
+              << " algo=" << algo
+              << (algo.rfind("dmm", 0) == 0 ? (" ds=" + dmm_ds) : (" queue=" + qname))
+              << " avg_cost="     << (solved ? sum_cost/solved : 0.0)
+              << " avg_expanded=" << (q ? (double)sum_expanded/q : 0.0)
+              << " avg_pushes="   << (q ? (double)sum_pushes/q : 0.0)
+              << " avg_pops="     << (q ? (double)sum_pops/q : 0.0)
+              << " avg_time_ms="  << (q ? sum_ms/q : 0.0)
+              << "\n";
+    if (n_threads > 1) std::cout << "Wall: threads=" << n_threads << " total_ms=" << wall_ms << "\n";
+
+    if (verify) {
+        // 기준: 힙 Dijkstra (상대 오차 1e-9 초과 또는 도달 여부가 다르면 불일치)
+        std::vector<pathlab::Dijkstra> refs(pool.size());
+        std::vector<uint8_t> bad(n_queries, 0);
+        pool.parallel_for(n_queries, /*grain=*/4, [&](unsigned w, size_t i) {
+            const pathlab::PathResult ref = refs[w].solve(ctxs[w], graph, queries[i].first, queries[i].second);
+            const pathlab::PathResult& res = results[i];
+            bad[i] = ref.found != res.found ||
+                     (ref.found && std::fabs(ref.cost - res.cost) > 1e-9 * std::max(1.0, ref.cost));
+        });
+        std::cout << "Verify: mismatches=" << std::count(bad.begin(), bad.end(), uint8_t{1})
+                  << "/" << n_queries << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,220 @@
+#include <iostream>
+#include <string>
+#include <iomanip>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cstdint>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+#include "pathlab/queues/binary_heap.hpp"
+#include "pathlab/queues/po_queue.hpp"
+#include "pathlab/queues/adaptive_po_queue.hpp"
+#include "pathlab/queues/radix_heap.hpp"
+#include "pathlab/queues/indexed_dary_heap.hpp"
+#include "pathlab/dmm/adaptive_ds.hpp"
+#include "pathlab/dmm/efficient_ds.hpp"
+
+// 큐 단독 마이크로벤치: 옥타일 격자형 단조 워크로드 (hold 모델)
+// - 프런티어 size개를 [0, √2) 키로 채운 뒤, pop한 키 d마다 d+1 또는 d+√2를 하나 push
+//   (Dijkstra 확장 흉내, 큐 크기 일정)
+// - 총 pop 수 ops에 도달하면 종료
+// - inversions/max_err: 직전 최대 pop 키보다 작은 키가 나온 횟수와 최대 오차 (정렬 오차)
+// - apo(AdaptivePOQueue)는 refills/spills(L1→L0 재분배, overflow로 간 push)도 출력
+//
+// BMSSP D 구조 비교 (--block M): 같은 hold 모델을 pull 단위로 돌린다
+// - pull()로 최대 M개(+동률)를 받고, 각 정점마다 d+1 또는 d+√2 후속을 하나 만든다.
+//   경계 x 미만이면 batch_prepend 묶음(K)으로, 아니면 insert (BMSSP 상위 루프와 같은 분기).
+// - 4번에 1번은 같은 후속을 더 큰 값으로 한 번 더 insert (정점당 최솟값 유지 경로).
+// - POQueue/BinaryHeap은 pull을 M번 pop으로 흉내 (경계 x 없음).
+// - viol: 반환값 ≥ x 이거나 직전 x보다 작은 값이 나온 횟수 (분리 조건 위반)
+
+static inline bool eq(const std::string& a, const char* b) {
+    return a == b;
+}
+
+struct Row {
+    double   ms{0.0};
+    uint64_t pushes{0}, pops{0}, inversions{0};
+    double   max_err{0.0};
+    size_t   peak{0};
+    uint64_t refills{0}, spills{0};   // AdaptivePOQueue 전용
+};
+
+template <class Queue>
+static Row run_queue(size_t ops, size_t size, uint32_t seed) {
+    const double SQRT2 = 1.41421356237309504880;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> coin(0, 1);
+    std::uniform_real_distribution<double> init(0.0, SQRT2);
+
+    std::vector<double> prio;          // id → 키
+    prio.reserve(ops + size);
+    Queue q;
+    for (size_t i = 0; i < size; ++i) {
+        prio.push_back(init(rng));
+        q.push((int)i, prio.back());
+    }
+
+    Row r;
+    double last = 0.0;
+    auto t0 = std::chrono::steady_clock::now();
+    while (!q.empty() && r.pops < ops) {
+        int u = *q.pop();
+        ++r.pops;
+        const double d = prio[u];
+        if (d < last) { ++r.inversions; r.max_err = std::max(r.max_err, last - d); }
+        else last = d;
+
+        const double nd = d + (coin(rng) ? SQRT2 : 1.0);
+        prio.push_back(nd);
+        q.push((int)prio.size() - 1, nd);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    r.ms     = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    r.pushes = q.push_count();
+    r.pops   = q.pop_count();
+    r.peak   = q.peak_size();
+    if constexpr (requires { q.refill_count(); q.spill_count(); }) {
+        r.refills = q.refill_count();
+        r.spills  = q.spill_count();
+    }
+    return r;
+}
+
+template <class DS>
+static Row run_ds(size_t ops, size_t size, size_t M, uint32_t seed) {
+    const double SQRT2 = 1.41421356237309504880;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> coin(0, 3);
+    std::uniform_real_distribution<double> init(0.0, SQRT2);
+
+    std::vector<double> prio;
+    prio.reserve(ops + size);
+    DS D;
+    D.reset(M, std::numeric_limits<double>::infinity());
+    for (size_t i = 0; i < size; ++i) {
+        prio.push_back(init(rng));
+        D.insert(i, prio.back());
+    }
+
+    Row r;
+    r.pushes = size;
+    double prev_x = 0.0;
+    std::vector<std::pair<size_t,double>> K;
+    auto t0 = std::chrono::steady_clock::now();
+    while (!D.is_empty() && r.pops < ops) {
+        auto [x, S] = D.pull();
+        K.clear();
+        for (size_t u : S) {
+            ++r.pops;
+            const double d = prio[u];
+            if (d >= x || d < prev_x) { ++r.inversions; r.max_err = std::max(r.max_err, std::abs(d - x)); }
+            const double nd = d + ((coin(rng) & 1) ? SQRT2 : 1.0);
+            prio.push_back(nd);
+            const size_t id = prio.size() - 1;
+            if (nd < x) K.emplace_back(id, nd);
+            else        D.insert(id, nd);
+            ++r.pushes;
+            if (coin(rng) == 0) { D.insert(id, nd + 1.0); ++r.pushes; } // 무시돼야 하는 중복
+        }
+        D.batch_prepend(K);
+        prev_x = x;
+        r.peak = std::max(r.peak, D.size());
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    r.ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    return r;
+}
+
+// 같은 워크로드를 일반 큐로: pull = M번 pop (dedup/경계 없음)
+template <class Queue>
+static Row run_ds_queue(size_t ops, size_t size, size_t M, uint32_t seed) {
+    const double SQRT2 = 1.41421356237309504880;
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> coin(0, 3);
+    std::uniform_real_distribution<double> init(0.0, SQRT2);
+
+    std::vector<double> prio;
+    prio.reserve(ops + size);
+    Queue q;
+    for (size_t i = 0; i < size; ++i) {
+        prio.push_back(init(rng));
+        q.push((int)i, prio.back());
+    }
+
+    Row r;
+    double last = 0.0;
+    std::vector<int> S;
+    auto t0 = std::chrono::steady_clock::now();
+    while (!q.empty() && r.pops < ops) {
+        S.clear();
+        while (S.size() < M && !q.empty()) S.push_back(*q.pop());
+        for (int u : S) {
+            ++r.pops;
+            const double d = prio[u];
+            if (d < last) { ++r.inversions; r.max_err = std::max(r.max_err, last - d); }
+            else last = d;
+            const double nd = d + ((coin(rng) & 1) ? SQRT2 : 1.0);
+            prio.push_back(nd);
+            q.push((int)prio.size() - 1, nd);
+            if (coin(rng) == 0) q.push((int)prio.size() - 1, nd + 1.0);
+        }
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    r.ms     = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    r.pushes = q.push_count();
+    r.peak   = q.peak_size();
+    return r;
+}
+
+static void print_row(const char* name, const Row& r) {
+    const double ops = double(r.pushes + r.pops);
+    std::cout << std::left << std::setw(10) << name
+              << " time_ms="    << std::fixed << std::setprecision(3) << r.ms
+              << " ns_per_op="  << std::setprecision(1) << (ops ? r.ms * 1e6 / ops : 0.0)
+              << " pushes="     << r.pushes
+              << " pops="       << r.pops
+              << " peak="       << r.peak
+              << " inversions=" << r.inversions
+              << " max_err="    << std::scientific << std::setprecision(2) << r.max_err;
+    if (r.refills || r.spills)
+        std::cout << " refills=" << r.refills << " spills=" << r.spills;
+    std::cout << "\n";
+}
+
+int main(int argc, char** argv) {
+    size_t   ops    = 2000000;
+    size_t   size   = 4096;
+    uint32_t seed   = 1;
+    size_t   block  = 64;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string a = argv[i];
+        if      (eq(a, "--ops") && i+1 < argc)    { ops    = std::stoul(argv[++i]); }
+        else if (eq(a, "--size") && i+1 < argc)   { size   = std::stoul(argv[++i]); }
+        else if (eq(a, "--seed") && i+1 < argc)   { seed   = (uint32_t)std::stoul(argv[++i]); }
+        else if (eq(a, "--block") && i+1 < argc)  { block  = std::stoul(argv[++i]); }
+        else {
+            std::cerr << "usage: bench_queues [--ops N] [--size M] [--seed S] [--block M]\n";
+            return 1;
+        }
+    }
+    std::cout << "Workload: ops=" << ops << " size=" << size << " seed=" << seed << "\n";
+
+    print_row("heap",  run_queue<pathlab::BinaryHeap<int,double>>(ops, size, seed));
+    print_row("po",    run_queue<pathlab::POQueue<int, 1000000ULL, 256, 256ULL>>(ops, size, seed));
+    print_row("apo",   run_queue<pathlab::AdaptivePOQueue<int>>(ops, size, seed));
+    print_row("radix", run_queue<pathlab::RadixHeap<int>>(ops, size, seed));
+    print_row("dary",  run_queue<pathlab::IndexedDaryHeap<int,double,4>>(ops, size, seed));
+
+    std::cout << "\nD structures (pull block=" << block << ", inversions = 분리 조건 위반)\n";
+    print_row("adaptive",  run_ds<pathlab::dmm::AdaptiveDataStructure>(ops, size, block, seed));
+    print_row("efficient", run_ds<pathlab::dmm::EfficientDataStructure>(ops, size, block, seed));
+    print_row("po",        run_ds_queue<pathlab::POQueue<int, 1000000ULL, 256, 256ULL>>(ops, size, block, seed));
+    print_row("apo",       run_ds_queue<pathlab::AdaptivePOQueue<int>>(ops, size, block, seed));
+    print_row("heap",      run_ds_queue<pathlab::BinaryHeap<int,double>>(ops, size, block, seed));
+    return 0;
+}
@@ -3,26 +3,84 @@
 #include <iomanip>
 #include <algorithm>
 #include <cstdint>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <type_traits>
+#include <map>
+#include <unordered_map>
+#include <limits>
 
 #include "pathlab/core/grid_map.hpp"
+#include "pathlab/core/landmark_table.hpp"
+#include "pathlab/core/first_move_table.hpp"
+#include "pathlab/core/hierarchical_graph.hpp"
+#include "pathlab/core/csr_graph.hpp"
+#include "pathlab/core/contraction_hierarchy.hpp"
 #include "pathlab/io/scen_loader.hpp"
+#include "pathlab/algorithms/search_context.hpp"
 #include "pathlab/algorithms/dijkstra.hpp"
 #include "pathlab/algorithms/astar.hpp"
-#include "pathlab/util/heuristic_factory.hpp"
+#include "pathlab/algorithms/dijkstra_po.hpp"
+#include "pathlab/algorithms/astar_po.hpp"
+#include "pathlab/algorithms/jps.hpp"
+#include "pathlab/algorithms/hpa_star.hpp"
+#include "pathlab/algorithms/ch_query.hpp"
+#include "pathlab/algorithms/packed_search.hpp"
+#include "pathlab/algorithms/bidirectional.hpp"
+#include "pathlab/algorithms/distance_table.hpp"
+#include "pathlab/queues/binary_heap.hpp"
+#include "pathlab/queues/po_queue.hpp"
+#include "pathlab/queues/adaptive_po_queue.hpp"
+#include "pathlab/queues/radix_heap.hpp"
+#include "pathlab/queues/indexed_dary_heap.hpp"
+#include "pathlab/algorithms/heuristic_dispatch.hpp"
+#include "pathlab/util/thread_pool.hpp"
 #include "pathlab/dmm/sssp.hpp"
 
 static inline bool eq(const std::string& a, const char* b) {
     return a == b;
 }
 
+// 큐 이름 → 타입 디스패치: f(std::type_identity<Queue>{})
+template <class F>
+static void with_queue(const std::string& q, F&& f) {
+    if      (q == "po")    f(std::type_identity<pathlab::POQueue<int, 1000000ULL, 256, 256ULL>>{});
+    else if (q == "apo")   f(std::type_identity<pathlab::AdaptivePOQueue<int>>{});
+    else if (q == "radix") f(std::type_identity<pathlab::RadixHeap<int>>{});
+    else if (q == "dary")  f(std::type_identity<pathlab::IndexedDaryHeap<int,double,4>>{});
+    else                   f(std::type_identity<pathlab::BinaryHeap<int,double>>{});
+}
+
 int main(int argc, char** argv) {
     if (argc < 3) {
         std::cerr
-          << "usage: bench_single <map_file> <scen_file>\n"
-          << "       [--astar] [--heuristic H] [--no-diag]\n"
-          << "       [--dmm] [--dmm-block N]\n"
-          << "       [--print N] [--limit N]\n"
-          << "  H: auto|manhattan|octile|euclidean|zero (default: auto)\n";
+          << "usage: bench_single <map_file> <scen_file>   (map_file: .map 또는 map_convert로 만든 .pmap)\n"
+          << "       [--astar] [--astar-po] [--dijkstra-po] [--jps] [--jps-plus] [--cpd] [--ch] [--hpa] [--cluster C] [--no-refine] [--layout L] [--packed P] [--bidir] [--bidir-threads] [--heuristic H] [--landmarks K] [--no-diag]\n"
+          << "       [--dmm] [--dmm-legacy] [--dmm-block N] [--dmm-ds D] [--queue Q]\n"
+          << "       [--one-to-many] [--matrix N] [--print N] [--limit N] [--threads N] [--by-bucket]\n"
+          << "  H: auto|manhattan|octile|euclidean|zero|alt (default: auto)\n"
+          << "  alt: 랜드마크 K개(--landmarks, default 16) 거리 테이블, <map_file>.alt에 저장/재사용\n"
+          << "  Q: heap|po|apo|radix|dary (default: heap, dijkstra/astar 공통)\n"
+          << "  --astar-po / --dijkstra-po: 부분순서 큐 A*/Dijkstra (--queue 없으면 po)\n"
+          << "  --jps-plus: <map_file>.jpsplus 점프 거리 테이블 사용 (없거나 맵과 다르면 생성·저장)\n"
+          << "  --cpd: <map_file>.cpd 첫 이동 테이블(CPD)로 탐색 없이 경로 추출 (없거나 맵과 다르면 --threads로 생성·저장)\n"
+          << "  --ch: 격자 → CSR 그래프 → Contraction Hierarchies, 양방향 상향 탐색 (<map_file>.ch에 저장/재사용)\n"
+          << "  --hpa: HPA* 근사 탐색 (C×C 클러스터, --cluster default 16, <map_file>.hpa에 저장/재사용)\n"
+          << "         --no-refine이면 추상 경로만. 시나리오 최적 길이 대비 초과율과 A* 대비 속도 향상을 함께 출력\n"
+          << "  --layout L: row|morton|hilbert — 격자를 L 순서로 번호 매긴 CSR 그래프에서 Dijkstra/A*\n"
+          << "              (g/parent/stamp 배열이 곡선 순서로 놓임, 경로만 y*W+x로 되돌림)\n"
+          << "  --packed P: float|steps — 노드당 8바이트 레코드(g + 방향 코드 + 스탬프)로 Dijkstra/A*\n"
+          << "              float: float g, steps: 직교/대각 이동 수로 정확한 정수 g\n"
+          << "  --bidir: 양방향 탐색 (--astar와 함께면 양방향 A*, 아니면 양방향 Dijkstra)\n"
+          << "  --bidir-threads: 양방향의 두 방향을 쿼리마다 두 스레드로 동시 실행\n"
+          << "  --dmm: 재귀 BMSSP, --dmm-legacy: 예전 블록 스켈레톤 (--dmm-block 사용)\n"
+          << "  D: efficient|adaptive (BMSSP의 D 구조, default: efficient)\n"
+          << "  --threads N: 시나리오를 N개 워커로 분할 실행 (0 = 하드웨어 스레드 수, 시나리오 파싱도 병렬)\n"
+          << "  --by-bucket: 시나리오 bucket별 요약 추가 출력\n"
+          << "  --one-to-many: 출발점이 같은 시나리오를 묶어 Dijkstra 한 번으로 거리만 계산\n"
+          << "               (통계는 묶음의 첫 케이스에 기록)\n"
+          << "  --matrix N: 앞 N개 시나리오의 출발점 × 목표 거리 행렬을 병렬 계산해 요약 출력\n";
         return 1;
     }
     std::string map_path  = argv[1];
@@ -31,76 +89,357 @@ int main(int argc, char** argv) {
     // ---- 옵션 파싱 ----
     bool use_astar   = false;
     bool use_dmm     = false;      // ★ 추가
+    bool dmm_legacy  = false;
+    std::string dmm_ds = "efficient";
     bool allow_diag  = true;
     bool use_astar_po = false;
+    bool use_dijkstra_po = false;
+    bool use_jps     = false;
+    bool use_jps_plus = false;
+    bool use_cpd     = false;
+    bool use_ch      = false;
+    bool use_hpa     = false;
+    bool hpa_refine  = true;
+    int cluster_size = 16;
+    std::string layout_name;       // 비어 있으면 패딩 격자 그대로
+    std::string packed_name;       // 비어 있으면 SearchContext (double g + parent ID)
+    bool use_bidir   = false;
+    bool bidir_threads = false;
     std::string hname = "auto";
+    std::string qname = "heap";
+    bool queue_set = false;
     size_t print_first = 5;
+    bool by_bucket = false;
+    bool one_to_many = false;
+    size_t matrix_n = 0;
     size_t limit_cases = 0;
     size_t dmm_block   = 1024;     // ★ 추가
+    int n_landmarks    = 16;
+    unsigned n_threads = 1;
 
     for (int i = 3; i < argc; ++i) {
         std::string a = argv[i];
         if      (eq(a, "--astar")) use_astar = true;
         else if (eq(a, "--dmm"))   use_dmm   = true;                    // ★
+        else if (eq(a, "--dmm-legacy")) use_dmm = dmm_legacy = true;
+        else if (eq(a, "--dmm-ds") && i+1 < argc)    { dmm_ds = argv[++i]; }
         else if (eq(a, "--no-diag")) allow_diag = false;
         else if (eq(a, "--heuristic") && i+1 < argc) { hname = argv[++i]; }
+        else if (eq(a, "--landmarks") && i+1 < argc) { n_landmarks = std::stoi(argv[++i]); }
+        else if (eq(a, "--queue") && i+1 < argc)     { qname = argv[++i]; queue_set = true; }
         else if (eq(a, "--print") && i+1 < argc)     { print_first = std::stoul(argv[++i]); }
+        else if (eq(a, "--by-bucket")) by_bucket = true;
+        else if (eq(a, "--one-to-many")) one_to_many = true;
+        else if (eq(a, "--matrix") && i+1 < argc)    { matrix_n = std::stoul(argv[++i]); }
         else if (eq(a, "--limit") && i+1 < argc)     { limit_cases = std::stoul(argv[++i]); }
         else if (eq(a, "--dmm-block") && i+1 < argc) { dmm_block   = std::stoul(argv[++i]); } // ★
         else if (eq(a, "--astar-po")) use_astar_po = true;
+        else if (eq(a, "--dijkstra-po")) use_dijkstra_po = true;
+        else if (eq(a, "--jps"))      use_jps = true;
+        else if (eq(a, "--jps-plus")) use_jps = use_jps_plus = true;
+        else if (eq(a, "--cpd"))      use_cpd = true;
+        else if (eq(a, "--ch"))       use_ch = true;
+        else if (eq(a, "--hpa"))      use_hpa = true;
+        else if (eq(a, "--no-refine")) hpa_refine = false;
+        else if (eq(a, "--cluster") && i+1 < argc)   { cluster_size = std::stoi(argv[++i]); }
+        else if (eq(a, "--layout") && i+1 < argc)    {
+            layout_name = argv[++i];
+            if (layout_name != "row" && layout_name != "morton" && layout_name != "hilbert") {
+                std::cerr << "unknown --layout: " << layout_name << " (row|morton|hilbert)\n";
+                return 1;
+            }
+        }
+        else if (eq(a, "--packed") && i+1 < argc)    {
+            packed_name = argv[++i];
+            if (packed_name != "float" && packed_name != "steps") {
+                std::cerr << "unknown --packed: " << packed_name << " (float|steps)\n";
+                return 1;
+            }
+        }
+        else if (eq(a, "--bidir"))    use_bidir = true;
+        else if (eq(a, "--bidir-threads")) use_bidir = bidir_threads = true;
+        else if (eq(a, "--threads") && i+1 < argc)   { n_threads   = (unsigned)std::stoul(argv[++i]); }
     }
 
+    // PO 변형은 큐만 다른 같은 코어: 큐를 지정하지 않았으면 POQueue
+    if ((use_astar_po || use_dijkstra_po) && !queue_set) qname = "po";
+
     // ---- 로드 ----
     pathlab::GridMap map;
+    const auto load_t0 = std::chrono::steady_clock::now();
     if (!map.load_from_file(map_path)) {
         std::cerr << "Failed to load map: " << map_path << "\n";
         return 1;
     }
-    std::cout << "Map: " << map.width() << "x" << map.height() << "\n";
+    std::cout << "Map: " << map.width() << "x" << map.height()
+              << (map.is_mapped() ? " (binary)" : "") << " load_ms="
+              << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - load_t0).count()
+              << "\n";
+
+    if (n_threads == 0) n_threads = std::max(1u, std::thread::hardware_concurrency());
 
     pathlab::ScenarioLoader sl;
-    if (!sl.load_from_file(scen_path)) {
+    const auto scen_t0 = std::chrono::steady_clock::now();
+    if (!sl.load_from_file(scen_path, n_threads)) {
         std::cerr << "Failed to load scen: " << scen_path << "\n";
         return 1;
     }
-    std::cout << "Scenarios: " << sl.scenarios().size() << "\n";
+    std::cout << "Scenarios: " << sl.size() << " load_ms="
+              << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - scen_t0).count()
+              << "\n";
 
     // ---- 누적지표 ----
     size_t   solved = 0;
     double   sum_cost = 0.0, sum_ms = 0.0;
-    uint64_t sum_expanded = 0, sum_pushes = 0, sum_pops = 0;
+    uint64_t sum_expanded = 0, sum_pushes = 0, sum_pops = 0, sum_peak = 0;
 
     // 휴리스틱 (A*일 때만 사용)
-    auto H = pathlab::make_heuristic(hname, allow_diag);
+    pathlab::LandmarkTable landmarks;
+    if (hname == "alt") {
+        auto t0 = std::chrono::steady_clock::now();
+        const bool cached = landmarks.load_or_build(map_path, map, n_landmarks, allow_diag);
+        std::cout << "Landmarks: " << (cached ? "loaded" : "built") << " K=" << landmarks.size() << " "
+                  << std::fixed << std::setprecision(3)
+                  << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count()
+                  << " ms\n";
+    }
+    auto H = pathlab::make_heuristic(hname, allow_diag, &landmarks);
 
     // ---- 실행 ----
-    const size_t n_total = sl.scenarios().size();
+    const size_t n_total = sl.size();
     const size_t n_run   = (limit_cases == 0 ? n_total : std::min(limit_cases, n_total));
 
-    for (size_t i = 0; i < n_run; ++i) {
-        const auto& s = sl.scenarios()[i];
-
-        pathlab::PathResult res;
-        if (use_dmm) {
-            pathlab::dmm::SSSP::Params P; P.block_size = dmm_block;
-            pathlab::dmm::SSSP alg(P);
-            res = alg.solve(map, s.start.x, s.start.y, s.goal.x, s.goal.y, allow_diag);
-        } else if (use_astar) {
-            pathlab::AStar ast;
-            res = ast.solve(map, s.start.x, s.start.y, s.goal.x, s.goal.y, allow_diag, H);
-        }else if (use_astar_po) {
-            pathlab::AStar astpo;
-            res = astpo.solve(map, s.start.x, s.start.y, s.goal.x, s.goal.y, allow_diag, H);
-        }else {
-            pathlab::Dijkstra dj;
-            res = dj.solve(map, s.start.x, s.start.y, s.goal.x, s.goal.y, allow_diag);
+    // 워커 풀: GridMap은 읽기 전용 공유, 솔버/작업공간은 워커별 소유
+    pathlab::ThreadPool pool(n_threads);
+    // 탐색 작업공간은 워커마다 하나씩, 시나리오 전체에서 재사용 (쿼리마다 O(1) 리셋)
+    std::vector<pathlab::SearchContext> ctxs(pool.size());
+    std::vector<pathlab::PathResult> results(n_run);
+
+    const auto wall_t0 = std::chrono::steady_clock::now();
+
+    // 케이스별 결과를 인덱스 위치에 저장 (solve_one: (worker, Scenario) → PathResult)
+    auto run_all = [&](auto&& solve_one) {
+        pool.parallel_for(n_run, /*grain=*/8, [&](unsigned w, size_t i) {
+            results[i] = solve_one(w, sl[i]);
+        });
+    };
+
+    pathlab::HierarchicalGraph hpa;
+
+    if (one_to_many) {
+        // 같은 출발점 → 목표 묶음 (파일 순서 유지)
+        std::unordered_map<int64_t, size_t> group_of;
+        std::vector<std::vector<size_t>> groups;
+        for (size_t i = 0; i < n_run; ++i) {
+            const pathlab::Scenario s = sl[i];
+            const int64_t key = ((int64_t)s.start.y << 32) | (uint32_t)s.start.x;
+            auto [it, fresh] = group_of.try_emplace(key, groups.size());
+            if (fresh) groups.emplace_back();
+            groups[it->second].push_back(i);
+        }
+        std::cout << "Groups: " << groups.size() << "\n";
+
+        with_queue(qname, [&](auto qt) {
+            using Q = typename decltype(qt)::type;
+            std::vector<pathlab::DistanceTableT<Q>> tabs(pool.size());
+            pool.parallel_for(groups.size(), /*grain=*/1, [&](unsigned w, size_t gi) {
+                const std::vector<size_t>& g = groups[gi];
+                std::vector<pathlab::Coord> goals;
+                goals.reserve(g.size());
+                for (size_t i : g) goals.push_back(sl[i].goal);
+                pathlab::SearchStats st;
+                const std::vector<double> d =
+                    tabs[w].one_to_many(ctxs[w], map, sl[g[0]].start, goals, allow_diag, &st);
+                for (size_t k = 0; k < g.size(); ++k) {
+                    pathlab::PathResult& res = results[g[k]];
+                    res.found = d[k] < std::numeric_limits<double>::infinity();
+                    res.cost  = res.found ? d[k] : 0.0;
+                    if (k == 0) res.stats = st;
+                }
+            });
+        });
+    } else if (use_dmm) {
+        pathlab::dmm::SSSP::Params P; P.block_size = dmm_block; P.legacy = dmm_legacy;
+        P.adaptive_ds = (dmm_ds == "adaptive");
+        std::vector<pathlab::dmm::SSSP> algs(pool.size(), pathlab::dmm::SSSP(P));
+        run_all([&](unsigned w, const pathlab::Scenario& s) {
+            return algs[w].solve(ctxs[w], map, s.start.x, s.start.y, s.goal.x, s.goal.y, allow_diag);
+        });
+    } else if (use_cpd) {
+        // 오프라인 테이블 (맵 전체 free 칸 × free 칸), 질의는 탐색 없이 첫 이동만 따라감
+        pathlab::FirstMoveTable cpd;
+        auto t0 = std::chrono::steady_clock::now();
+        const bool cached = cpd.load_or_build(map_path, map, allow_diag, pool.size());
+        std::cout << "CPD: " << (cached ? "loaded" : "built") << " runs=" << cpd.run_count()
+                  << " MB=" << std::fixed << std::setprecision(1) << cpd.bytes() / (1024.0 * 1024.0) << " "
+                  << std::setprecision(3)
+                  << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count()
+                  << " ms\n";
+        run_all([&](unsigned, const pathlab::Scenario& s) {
+            return cpd.path(s.start.x, s.start.y, s.goal.x, s.goal.y);
+        });
+    } else if (use_ch) {
+        auto t0 = std::chrono::steady_clock::now();
+        const pathlab::CsrGraph graph = pathlab::CsrGraph::from_grid(map, allow_diag);
+        pathlab::ContractionHierarchy ch;
+        const bool cached = ch.load_or_build(map_path, graph, pool.size());
+        std::cout << "CH: " << (cached ? "loaded" : "built") << " nodes=" << graph.node_count()
+                  << " edges=" << graph.edge_count() << " up_arcs=" << ch.arc_count()
+                  << " shortcuts=" << ch.shortcut_count() << " "
+                  << std::fixed << std::setprecision(3)
+                  << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count()
+                  << " ms\n";
+        with_queue(qname, [&](auto qt) {
+            using Q = typename decltype(qt)::type;
+            std::vector<pathlab::CHQueryT<Q>> algs(pool.size(), pathlab::CHQueryT<Q>(&ch, &graph));
+            run_all([&](unsigned w, const pathlab::Scenario& s) {
+                return algs[w].solve(ctxs[w], s.start.x, s.start.y, s.goal.x, s.goal.y);
+            });
+        });
+    } else if (use_hpa) {
+        auto t0 = std::chrono::steady_clock::now();
+        const bool cached = hpa.load_or_build(map_path, map, cluster_size, allow_diag, pool.size());
+        std::cout << "HPA: " << (cached ? "loaded" : "built") << " cluster=" << hpa.cluster_size()
+                  << " clusters=" << hpa.cluster_count() << " nodes=" << hpa.node_count()
+                  << " edges=" << hpa.edge_count() << " "
+                  << std::fixed << std::setprecision(3)
+                  << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count()
+                  << " ms\n";
+        with_queue(qname, [&](auto qt) {
+            using Q = typename decltype(qt)::type;
+            std::vector<pathlab::HPAStarT<Q>> algs(pool.size(), pathlab::HPAStarT<Q>(&hpa, hpa_refine));
+            run_all([&](unsigned w, const pathlab::Scenario& s) {
+                return algs[w].solve(ctxs[w], map, s.start.x, s.start.y, s.goal.x, s.goal.y, allow_diag);
+            });
+        });
+    } else if (use_jps) {
+        // 균일 비용 8방 전용 (휴리스틱은 옥타일 고정)
+        pathlab::JumpTable table;
+        if (use_jps_plus && allow_diag) {
+            auto t0 = std::chrono::steady_clock::now();
+            const bool cached = table.load_or_build(map_path, map);
+            std::cout << "JumpTable: " << (cached ? "loaded" : table.empty() ? "unsupported (map too large, plain JPS)" : "built") << " "
+                      << std::fixed << std::setprecision(3)
+                      << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count()
+                      << " ms\n";
         }
+        with_queue(qname, [&](auto qt) {
+            using Q = typename decltype(qt)::type;
+            std::vector<pathlab::JPST<Q>> algs(pool.size(), pathlab::JPST<Q>(table.empty() ? nullptr : &table));
+            run_all([&](unsigned w, const pathlab::Scenario& s) {
+                return algs[w].solve(ctxs[w], map, s.start.x, s.start.y, s.goal.x, s.goal.y, allow_diag);
+            });
+        });
+    } else if (use_bidir) {
+        // --astar 없으면 zero 휴리스틱 → 양방향 Dijkstra
+        const pathlab::Heuristic BH = use_astar ? H : pathlab::make_heuristic("zero", allow_diag);
+        with_queue(qname, [&](auto qt) {
+            using Q = typename decltype(qt)::type;
+            pathlab::dispatch_heuristic(BH, [&](auto hp) {
+                std::vector<pathlab::BidirectionalT<Q>> algs(pool.size());
+                for (auto& a : algs) a.set_two_threads(bidir_threads);
+                run_all([&](unsigned w, const pathlab::Scenario& s) {
+                    return algs[w].solve(ctxs[w], map, s.start.x, s.start.y, s.goal.x, s.goal.y, allow_diag, hp);
+                });
+            });
+        });
+    } else if (!packed_name.empty()) {
+        // 패킹 레코드 (노드당 8바이트), --astar 없으면 zero 휴리스틱 → Dijkstra
+        const pathlab::Heuristic PH = (use_astar || use_astar_po) ? H : pathlab::make_heuristic("zero", allow_diag);
+        auto run_packed = [&](auto rec) {
+            using Rec = decltype(rec);
+            std::cout << "Packed: " << packed_name << " bytes_per_node="
+                      << pathlab::PackedSearchContext<Rec>::bytes_per_node() << "\n";
+            std::vector<pathlab::PackedSearchContext<Rec>> pctxs(pool.size());
+            with_queue(qname, [&](auto qt) {
+                using Q = typename decltype(qt)::type;
+                pathlab::dispatch_heuristic(PH, [&](auto hp) {
+                    std::vector<pathlab::PackedGridSearchT<Q, Rec>> algs(pool.size());
+                    run_all([&](unsigned w, const pathlab::Scenario& s) {
+                        return algs[w].solve(pctxs[w], map, s.start.x, s.start.y, s.goal.x, s.goal.y, allow_diag, hp);
+                    });
+                });
+            });
+        };
+        if (packed_name == "float") run_packed(pathlab::FloatNodeRecord{});
+        else                        run_packed(pathlab::StepCountNodeRecord{});
+    } else if (!layout_name.empty()) {
+        // 같은 격자를 공간 채움 곡선 순서의 CSR 그래프로 바꿔 Dijkstra/A* (큐·휴리스틱은 격자 경로와 동일)
+        const pathlab::GridLayout layout = layout_name == "morton"  ? pathlab::GridLayout::Morton
+                                         : layout_name == "hilbert" ? pathlab::GridLayout::Hilbert
+                                                                    : pathlab::GridLayout::RowMajor;
+        auto t0 = std::chrono::steady_clock::now();
+        const pathlab::CsrGraph graph = pathlab::CsrGraph::from_grid(map, allow_diag, layout);
+        std::cout << "Layout: " << layout_name << " nodes=" << graph.node_count()
+                  << " edges=" << graph.edge_count()
+                  << " cross_line_pct=" << std::fixed << std::setprecision(1)
+                  << 100.0 * graph.cross_line_fraction() << " "
+                  << std::setprecision(3)
+                  << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count()
+                  << " ms\n";
+        const int W = map.width();
+        auto to_grid = [&](pathlab::PathResult r) {
+            for (int& v : r.path) v = graph.grid_id((uint32_t)v);
+            return r;
+        };
+        with_queue(qname, [&](auto qt) {
+            using Q = typename decltype(qt)::type;
+            if (use_astar || use_astar_po) {
+                pathlab::dispatch_heuristic(H, [&](auto hp) {
+                    std::vector<pathlab::AStarT<Q>> algs(pool.size());
+                    run_all([&](unsigned w, const pathlab::Scenario& s) {
+                        const int gx = s.goal.x, gy = s.goal.y;
+                        return to_grid(algs[w].solve(ctxs[w], graph, graph.node_at(s.start.x, s.start.y),
+                                                     graph.node_at(gx, gy), [&, gx, gy](int v) {
+                            const int c = graph.grid_id((uint32_t)v);
+                            return hp(c % W, c / W, gx, gy);
+                        }));
+                    });
+                });
+            } else {
+                std::vector<pathlab::DijkstraT<Q>> algs(pool.size());
+                run_all([&](unsigned w, const pathlab::Scenario& s) {
+                    return to_grid(algs[w].solve(ctxs[w], graph, graph.node_at(s.start.x, s.start.y),
+                                                 graph.node_at(s.goal.x, s.goal.y)));
+                });
+            }
+        });
+    } else if (use_astar || use_astar_po) {
+        with_queue(qname, [&](auto qt) {
+            using Q = typename decltype(qt)::type;
+            // 휴리스틱은 배치당 한 번만 정책 타입으로 디스패치 (노드당 간접 호출 X)
+            pathlab::dispatch_heuristic(H, [&](auto hp) {
+                static_assert(std::is_same_v<pathlab::AStarT<Q>, pathlab::AStarPOT<Q>>); // 큐만 다른 같은 코어
+                std::vector<pathlab::AStarT<Q>> algs(pool.size());
+                run_all([&](unsigned w, const pathlab::Scenario& s) {
+                    return algs[w].solve(ctxs[w], map, s.start.x, s.start.y, s.goal.x, s.goal.y, allow_diag, hp);
+                });
+            });
+        });
+    } else {
+        with_queue(qname, [&](auto qt) {
+            using Q = typename decltype(qt)::type;
+            static_assert(std::is_same_v<pathlab::DijkstraT<Q>, pathlab::DijkstraPOT<Q>>);
+            std::vector<pathlab::DijkstraT<Q>> algs(pool.size());
+            run_all([&](unsigned w, const pathlab::Scenario& s) {
+                return algs[w].solve(ctxs[w], map, s.start.x, s.start.y, s.goal.x, s.goal.y, allow_diag);
+            });
+        });
+    }
+
+    const double wall_ms =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - wall_t0).count();
+
+    // 케이스 순서대로 누적 → 스레드 수와 무관하게 동일한 합산 순서
+    for (size_t i = 0; i < n_run; ++i) {
+        const pathlab::PathResult& res = results[i];
 
         if (res.found) { ++solved; sum_cost += res.cost; }
         sum_ms       += res.stats.millis;
         sum_expanded += res.stats.expanded;
         sum_pushes   += res.stats.pushes;
         sum_pops     += res.stats.pops;
+        sum_peak     += res.stats.peak_open;
 
         if (i < print_first) {
             std::cout << "Case[" << i << "] "
@@ -109,6 +448,7 @@ int main(int argc, char** argv) {
                       << " expanded=" << res.stats.expanded
                       << " pushes="   << res.stats.pushes
                       << " pops="     << res.stats.pops
+                      << " peak_open=" << res.stats.peak_open
                       << " time_ms="  << std::fixed << std::setprecision(3) << res.stats.millis
                       << "\n";
         }
@@ -116,20 +456,99 @@ int main(int argc, char** argv) {
 
     // ---- 요약 ----
     const size_t n = n_run;
-    std::string algo_name =use_dmm ? "dmm" : (use_astar_po ? "astar-po" : (use_astar ? "astar" : "dijkstra"));
-    std::string heur_name = (use_astar ? H.name : std::string("n/a"));
+    std::string algo_name = one_to_many ? "one-to-many" : use_dmm ? (dmm_legacy ? "dmm-legacy" : "dmm") : use_cpd ? "cpd" : use_ch ? "ch" : use_hpa ? (hpa_refine ? "hpa" : "hpa-abstract") : use_jps_plus ? "jps-plus" : use_jps ? "jps" :
+                            use_bidir ? (use_astar ? "bidir-astar" : "bidir-dijkstra") : (use_astar_po ? "astar-po" : use_astar ? "astar" : use_dijkstra_po ? "dijkstra-po" : "dijkstra");
+    std::string heur_name = (use_jps || use_hpa) ? std::string(allow_diag ? "octile" : "manhattan")
+                                    : ((use_astar || use_astar_po) ? H.name : std::string("n/a"));
 
     std::cout << "\nSummary (" << solved << "/" << n << " solved)"
               << " algo=" << algo_name
               << " heuristic=" << heur_name
               << " diag=" << (allow_diag ? "on" : "off")
-              << (use_dmm ? (" block=" + std::to_string(dmm_block)) : "")
+              << (dmm_legacy ? (" block=" + std::to_string(dmm_block)) : use_dmm ? (" ds=" + dmm_ds) : (" queue=" + qname))
+              << (layout_name.empty() ? "" : " layout=" + layout_name)
+              << (packed_name.empty() ? "" : " packed=" + packed_name)
               << " avg_cost="     << (solved ? sum_cost/solved : 0.0)
               << " avg_expanded=" << (n ? (double)sum_expanded/n : 0.0)
               << " avg_pushes="   << (n ? (double)sum_pushes/n   : 0.0)
               << " avg_pops="     << (n ? (double)sum_pops/n     : 0.0)
+              << " avg_peak_open=" << (n ? (double)sum_peak/n    : 0.0)
               << " avg_time_ms="  << (n ? sum_ms/n : 0.0)
               << "\n";
 
+    if (n_threads > 1) {
+        std::cout << "Wall: threads=" << n_threads << " total_ms=" << wall_ms << "\n";
+    }
+
+    if (use_hpa) {
+        // 기준: 같은 큐의 정확한 A* (8방 옥타일 / 4방 맨해튼)로 같은 케이스를 다시 풀어 시간 비교.
+        // 초과율 기준은 시나리오 optimal_length (8방 기준이라 4방이면 A* 비용).
+        std::vector<pathlab::PathResult> exact(n_run);
+        with_queue(qname, [&](auto qt) {
+            using Q = typename decltype(qt)::type;
+            std::vector<pathlab::HPAStarT<Q>> algs(pool.size()); // 그래프 없음 → 정확한 A*
+            pool.parallel_for(n_run, /*grain=*/8, [&](unsigned w, size_t i) {
+                const pathlab::Scenario s = sl[i];
+                exact[i] = algs[w].solve(ctxs[w], map, s.start.x, s.start.y, s.goal.x, s.goal.y, allow_diag);
+            });
+        });
+        double exact_ms = 0.0, sum_sub = 0.0, max_sub = 0.0;
+        size_t n_sub = 0;
+        for (size_t i = 0; i < n_run; ++i) {
+            exact_ms += exact[i].stats.millis;
+            const double opt = allow_diag ? sl[i].optimal_length : exact[i].cost;
+            if (!results[i].found || !(opt > 0)) continue;
+            const double sub = results[i].cost / opt - 1.0;
+            sum_sub += sub;
+            max_sub = std::max(max_sub, sub);
+            ++n_sub;
+        }
+        std::cout << "Suboptimality: vs=" << (allow_diag ? "scen" : "astar")
+                  << " avg_subopt_pct=" << (n_sub ? 100.0 * sum_sub / n_sub : 0.0)
+                  << " max_subopt_pct=" << 100.0 * max_sub
+                  << " astar_avg_time_ms=" << (n ? exact_ms/n : 0.0)
+                  << " speedup=" << (sum_ms > 0 ? exact_ms / sum_ms : 0.0)
+                  << "\n";
+    }
+
+    if (matrix_n > 0) {
+        const size_t m = std::min(matrix_n, n_total);
+        std::vector<pathlab::Coord> srcs, dsts;
+        for (size_t i = 0; i < m; ++i) { srcs.push_back(sl[i].start); dsts.push_back(sl[i].goal); }
+        with_queue(qname, [&](auto qt) {
+            using Q = typename decltype(qt)::type;
+            pathlab::DistanceMatrixT<Q> builder;
+            const pathlab::DistanceMatrix M = builder.compute(pool, map, srcs, dsts, allow_diag);
+            size_t reachable = 0;
+            for (double v : M.d) reachable += v < std::numeric_limits<double>::infinity();
+            std::cout << "Matrix: " << M.rows << "x" << M.cols
+                      << " reachable=" << reachable
+                      << " expanded=" << M.stats.expanded
+                      << " total_ms=" << M.stats.millis
+                      << "\n";
+        });
+    }
+
+    if (by_bucket) {
+        struct Agg { size_t n{0}, solved{0}; double cost{0.0}, ms{0.0}; uint64_t expanded{0}; };
+        std::map<int, Agg> per;
+        const auto& buckets = sl.buckets();
+        for (size_t i = 0; i < n_run; ++i) {
+            const pathlab::PathResult& res = results[i];
+            Agg& a = per[buckets[i]];
+            ++a.n;
+            if (res.found) { ++a.solved; a.cost += res.cost; }
+            a.ms       += res.stats.millis;
+            a.expanded += res.stats.expanded;
+        }
+        for (const auto& [b, a] : per) {
+            std::cout << "Bucket[" << b << "] n=" << a.n << " solved=" << a.solved
+                      << " avg_cost="     << (a.solved ? a.cost/a.solved : 0.0)
+                      << " avg_expanded=" << (double)a.expanded/a.n
+                      << " avg_time_ms="  << a.ms/a.n
+                      << "\n";
+        }
+    }
+
     return 0;
 }
@@ -0,0 +1,74 @@
+#include <iostream>
+#include <string>
+#include <iomanip>
+#include <chrono>
+#include <cstring>
+
+#include "pathlab/core/grid_map.hpp"
+
+// MovingAI .map → 바이너리 맵(.pmap) 변환
+// - 저장 후 다시 열어 점유/이웃 마스크가 원본과 같은지 확인한다.
+// - 시간: ASCII 파싱 vs 바이너리 mmap 로드
+
+static inline bool eq(const std::string& a, const char* b) {
+    return a == b;
+}
+
+static double ms_since(std::chrono::steady_clock::time_point t0) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count();
+}
+
+int main(int argc, char** argv) {
+    std::string in_path, out_path;
+    bool with_masks = true;
+    for (int i = 1; i < argc; ++i) {
+        std::string a = argv[i];
+        if      (eq(a, "--no-masks")) with_masks = false;
+        else if (in_path.empty())     in_path = a;
+        else if (out_path.empty())    out_path = a;
+        else                          in_path.clear(); // 인자 과다 → usage
+    }
+    if (in_path.empty()) {
+        std::cerr << "usage: map_convert <map_file> [out_file] [--no-masks]\n"
+                  << "  out_file 기본값: <map_file>.pmap\n"
+                  << "  --no-masks: 이웃 마스크를 저장하지 않음 (로드 시 계산, 파일이 작아짐)\n";
+        return 1;
+    }
+    if (out_path.empty()) out_path = pathlab::GridMap::default_binary_path(in_path);
+
+    pathlab::GridMap src;
+    auto t0 = std::chrono::steady_clock::now();
+    if (!src.load_from_file(in_path)) {
+        std::cerr << "Failed to load map: " << in_path << "\n";
+        return 1;
+    }
+    const double parse_ms = ms_since(t0);
+
+    if (!src.save_binary(out_path, with_masks)) {
+        std::cerr << "Failed to write: " << out_path << "\n";
+        return 1;
+    }
+
+    pathlab::GridMap bin;
+    t0 = std::chrono::steady_clock::now();
+    if (!bin.load_from_file(out_path)) {
+        std::cerr << "Failed to reload: " << out_path << "\n";
+        return 1;
+    }
+    const double load_ms = ms_since(t0);
+
+    const size_t n = (size_t)src.padded_size();
+    const bool same = bin.width() == src.width() && bin.height() == src.height() &&
+                      std::memcmp(bin.occupancy(), src.occupancy(), n) == 0 &&
+                      std::memcmp(bin.neighbor_masks(), src.neighbor_masks(), n) == 0;
+    if (!same) {
+        std::cerr << "Verify failed: " << out_path << "\n";
+        return 1;
+    }
+
+    std::cout << "Map: " << src.width() << "x" << src.height() << " -> " << out_path
+              << (with_masks ? " (masks)" : "") << "\n"
+              << "ascii_ms=" << std::fixed << std::setprecision(3) << parse_ms
+              << " binary_ms=" << load_ms << "\n";
+    return 0;
+}
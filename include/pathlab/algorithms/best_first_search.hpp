@@ -0,0 +1,199 @@
+#pragma once
+#include <vector>
+#include <limits>
+#include <chrono>
+#include <cmath>
+#include <utility>
+#include <bit>
+#include <type_traits>
+#include "pathlab/algorithms/ipathfinder.hpp"
+#include "pathlab/algorithms/search_context.hpp"
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/core/graph.hpp"
+#include "pathlab/queues/binary_heap.hpp"
+#include "pathlab/algorithms/heuristic_dispatch.hpp"
+
+namespace pathlab {
+
+// 휴리스틱 정책 자리표시: solve가 런타임 Heuristic을 받아 정책 타입으로 한 번 디스패치 (A* 계열)
+struct DynamicHeuristic {};
+
+// 연결성 정책: dirs(allow_diagonal) → 이웃 마스크에 AND할 방향 비트 (DIR_DX/DIR_DY 순서)
+struct RuntimeConnectivity {   // solve 인자 allow_diagonal을 따른다
+  static constexpr unsigned dirs(bool allow_diagonal) { return allow_diagonal ? 0xFFu : 0x0Fu; }
+};
+struct EightConnected {        // 항상 8방 (인자 무시)
+  static constexpr unsigned dirs(bool) { return 0xFFu; }
+};
+struct FourConnected {         // 항상 4방 (인자 무시)
+  static constexpr unsigned dirs(bool) { return 0x0Fu; }
+};
+
+// 격자 최선 우선 탐색 공통 코어: Dijkstra / AStar / DijkstraPO / AStarPO는 이 템플릿의 별칭
+// - Queue: IPriorityQueue<int,double> 구현 (BinaryHeap, POQueue, AdaptivePOQueue, RadixHeap 등)
+// - HPolicy: 고정 휴리스틱 정책(ZeroH → Dijkstra) 또는 DynamicHeuristic (solve에 Heuristic 전달)
+// - Conn: 연결성 정책
+// - 키 f = g + h, lazy decrease-key(중복 push) + closed 검사로 stale pop 건너뜀, goal pop 시 종료.
+// - 루프 본체는 sweep(정지 조건을 받는 버전)에 있고 solve와 다중 목표 거리표(distance_table.hpp)가 공유.
+//   sweep은 SearchGraph(core/graph.hpp) 일반이라 격자(GridGraph 뷰)와 CsrGraph가 같은 루프를 쓴다.
+//   부분순서 큐는 reopen 없이 닫으므로 큐 오차가 비용 오차로 이어질 수 있다.
+template <class Queue = BinaryHeap<int,double>,
+          class HPolicy = DynamicHeuristic,
+          class Conn = RuntimeConnectivity>
+class BestFirstSearch {
+public:
+  using queue_type = Queue;
+  static constexpr bool dynamic_heuristic = std::is_same_v<HPolicy, DynamicHeuristic>;
+  static_assert(dynamic_heuristic || HeuristicPolicy<HPolicy>, "HPolicy must be a heuristic policy or DynamicHeuristic");
+
+  // --- 고정 휴리스틱 (Dijkstra 계열) ---
+  PathResult solve(const GridMap& map, int sx, int sy, int gx, int gy, bool allow_diagonal = true)
+    requires (!dynamic_heuristic) {
+    SearchContext ctx;
+    return solve(ctx, map, sx, sy, gx, gy, allow_diagonal);
+  }
+
+  // ctx를 쿼리 간 재사용 (O(1) 리셋)
+  PathResult solve(SearchContext& ctx, const GridMap& map, int sx, int sy, int gx, int gy,
+                   bool allow_diagonal = true)
+    requires (!dynamic_heuristic) {
+    return solve(ctx, map, sx, sy, gx, gy, allow_diagonal, HPolicy{});
+  }
+
+  // --- 런타임 휴리스틱 (A* 계열) ---
+  PathResult solve(const GridMap& map,
+                   int sx, int sy, int gx, int gy,
+                   bool allow_diagonal = true,
+                   Heuristic H = make_heuristic("auto", /*allow_diagonal=*/true))
+    requires dynamic_heuristic {
+    SearchContext ctx;
+    return solve(ctx, map, sx, sy, gx, gy, allow_diagonal, std::move(H));
+  }
+
+  // ctx를 쿼리 간 재사용 (O(1) 리셋)
+  PathResult solve(SearchContext& ctx, const GridMap& map,
+                   int sx, int sy, int gx, int gy,
+                   bool allow_diagonal = true,
+                   Heuristic H = make_heuristic("auto", /*allow_diagonal=*/true))
+    requires dynamic_heuristic {
+    return dispatch_heuristic(H, [&](auto hp) {
+      return solve(ctx, map, sx, sy, gx, gy, allow_diagonal, hp);
+    });
+  }
+
+  // 휴리스틱 정책 타입으로 인스턴스화 (h 호출이 인라인됨, ZeroH면 h 항이 사라짐)
+  template <HeuristicPolicy HP>
+  PathResult solve(SearchContext& ctx, const GridMap& map,
+                   int sx, int sy, int gx, int gy,
+                   bool allow_diagonal, HP hp) {
+    PathResult r;
+
+    const int W = map.width(), Ht = map.height();
+    if (W<=0 || Ht<=0) return r;
+    if (sx<0||sy<0||gx<0||gy<0||sx>=W||gx>=W||sy>=Ht||gy>=Ht) return r;
+    if (!map.is_free(sx,sy) || !map.is_free(gx,gy)) return r;
+
+    const double INF = std::numeric_limits<double>::infinity();
+    const int sId = map.to_padded(sx,sy), gId = map.to_padded(gx,gy);
+    r.stats = sweep(ctx, map, sId, gx, gy, allow_diagonal, hp,
+                    [gId](int u) { return u == gId; }); // goal pop되면 확장 없이 종료
+
+    if (ctx.g(gId) == INF) { r.found=false; return r; }
+    r.found = true;
+    r.cost  = ctx.g(gId);
+
+    // 경로 복원
+    std::vector<int> rev;
+    for (int v=gId; v!=-1; v=ctx.parent(v)) rev.push_back(map.from_padded(v));
+    r.path.assign(rev.rbegin(), rev.rend());
+    return r;
+  }
+
+  // --- 일반 그래프 (SearchGraph, 예: CsrGraph): Dijkstra 계열만, 노드 ID로 질의/경로 ---
+  template <SearchGraph G>
+  PathResult solve(SearchContext& ctx, const G& graph, int s, int t)
+    requires std::is_same_v<HPolicy, ZeroH> {
+    return solve(ctx, graph, s, t, [](int) { return 0.0; });
+  }
+
+  // 노드 휴리스틱 h(v)를 직접 받는 버전 (예: CSR 격자 그래프에서 노드 → 좌표 → 옥타일로 A*)
+  template <SearchGraph G, class HFn>
+  PathResult solve(SearchContext& ctx, const G& graph, int s, int t, HFn&& h)
+    requires std::is_invocable_r_v<double, const HFn&, int> {
+    PathResult r;
+    const int n = (int)graph.node_count();
+    if (s<0||t<0||s>=n||t>=n) return r;
+
+    r.stats = sweep(ctx, graph, s, h, [t](int u) { return u == t; });
+    if (ctx.g(t) == std::numeric_limits<double>::infinity()) return r;
+    r.found = true;
+    r.cost  = ctx.g(t);
+    std::vector<int> rev;
+    for (int v=t; v!=-1; v=ctx.parent(v)) rev.push_back(v);
+    r.path.assign(rev.rbegin(), rev.rend());
+    return r;
+  }
+
+  // 격자 루프: 패딩 ID sId에서 시작, (gx,gy)는 휴리스틱 목표 좌표 (ZeroH면 무시).
+  // stale이 아닌 pop(= g 확정) 노드마다 stop(u)를 부르고 true면 확장 없이 종료.
+  // 결과는 ctx의 g/parent, 반환값은 통계. sId는 free 칸이어야 한다.
+  template <HeuristicPolicy HP, class Stop>
+  SearchStats sweep(SearchContext& ctx, const GridMap& map, int sId, int gx, int gy,
+                    bool allow_diagonal, HP hp, Stop&& stop) {
+    // 내부 탐색은 패딩 ID 공간 (범위 검사 없음), 유효 이동(corner-cutting 금지 포함)은 이웃 마스크
+    return sweep(ctx, GridGraph(map, Conn::dirs(allow_diagonal)), sId,
+                 [&](int v) { return hp(map.padded_x(v), map.padded_y(v), gx, gy); },
+                 std::forward<Stop>(stop));
+  }
+
+  // 공통 루프 (그래프 일반): h(v)는 노드 휴리스틱, 나머지는 격자 sweep과 같다.
+  template <SearchGraph G, class HFn, class Stop>
+  SearchStats sweep(SearchContext& ctx, const G& graph, int sId, HFn&& h, Stop&& stop) {
+    auto t0 = std::chrono::steady_clock::now();
+    const size_t N = graph.node_count();
+    ctx.begin(N);
+
+    // 큐는 솔버 멤버: 비우기만 하고 버퍼/위치 맵은 재사용 (reserve는 노드 수가 늘 때만 할당)
+    Queue& open = open_;
+    open.clear();
+    if constexpr (requires { open.reserve(size_t{}); }) open.reserve(N); // 인덱스 큐 위치 맵
+
+    ctx.set(sId, 0.0, -1);
+    open.push(sId, h(sId)); // f(s)=0+h(s)
+
+    uint64_t expanded = 0;
+
+    while (!open.empty()) {
+      int u = *open.pop();
+      if (ctx.closed(u)) continue;  // stale pop
+      if (stop(u)) break;
+      ctx.close(u);
+
+      ++expanded;
+
+      const double gu = ctx.g(u);
+      graph.for_each_out(u, [&](int v, double w) {
+        if (ctx.closed(v)) return;
+        double ng = gu + w;
+        if (ng < ctx.g(v)) {
+          ctx.set(v, ng, u);
+          open.push(v, ng + h(v));   // lazy decrease-key
+        }
+      });
+    }
+
+    auto t1 = std::chrono::steady_clock::now();
+    SearchStats st;
+    st.millis    = std::chrono::duration<double,std::milli>(t1-t0).count();
+    st.expanded  = expanded;
+    st.pushes    = open.push_count();
+    st.pops      = open.pop_count();
+    st.peak_open = open.peak_size();
+    return st;
+  }
+
+private:
+  Queue open_;
+};
+
+} // namespace pathlab
@@ -0,0 +1,253 @@
+#pragma once
+#include <vector>
+#include <limits>
+#include <chrono>
+#include <cmath>
+#include <utility>
+#include <bit>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <algorithm>
+#include "pathlab/algorithms/ipathfinder.hpp"
+#include "pathlab/algorithms/search_context.hpp"
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/core/graph.hpp"
+#include "pathlab/queues/binary_heap.hpp"
+#include "pathlab/algorithms/heuristic_dispatch.hpp"
+#include "pathlab/util/thread_pool.hpp"
+
+namespace pathlab {
+
+namespace detail {
+
+// 두 스레드 모드에서 상대 방향이 읽는 g 공개본 (세대 스탬프로 O(1) 리셋)
+// - g를 먼저 쓰고 스탬프를 나중에 쓰므로, 스탬프가 이번 세대면 g도 이번 쿼리 값.
+// - 모든 접근은 seq_cst: 두 방향이 같은 간선을 동시에 라벨링해도 최소 한쪽은 상대를 본다.
+class SharedLabels {
+public:
+  void begin(size_t n) {
+    if (n_ < n) {
+      g_.reset(new std::atomic<double>[n]);
+      stamp_.reset(new std::atomic<uint32_t>[n]);
+      for (size_t i = 0; i < n; ++i) stamp_[i].store(0, std::memory_order_relaxed);
+      n_ = n; epoch_ = 0;
+    }
+    if (++epoch_ == 0) {
+      for (size_t i = 0; i < n_; ++i) stamp_[i].store(0, std::memory_order_relaxed);
+      epoch_ = 1;
+    }
+  }
+  void set(int v, double g) { g_[v].store(g); stamp_[v].store(epoch_); }
+  double get(int v) const {
+    return stamp_[v].load() == epoch_ ? g_[v].load() : std::numeric_limits<double>::infinity();
+  }
+
+private:
+  std::unique_ptr<std::atomic<double>[]>   g_;
+  std::unique_ptr<std::atomic<uint32_t>[]> stamp_;
+  size_t   n_{0};
+  uint32_t epoch_{0};
+};
+
+} // namespace detail
+
+// 양방향 A* / Dijkstra (ZeroH → 양방향 Dijkstra)
+// - 균형 포텐셜 pf(v) = (h(v,t) - h(s,v))/2, pr = -pf (일관 휴리스틱이면 두 방향 모두 감소 비용 ≥ 0).
+//   큐 키는 g ± pf + c, c = h(s,t)/2 로 음수가 되지 않게 올린다 (RadixHeap/POQueue 호환).
+// - 종료: 양쪽 마지막 pop 키 합 ≥ μ + 2c (μ = 지금까지 찾은 최단 s-t 경로). 키가 단조이므로 최적.
+// - 확장 방향은 open 크기가 작은 쪽 (cardinality 균형).
+// - 후진 탐색 작업공간은 솔버가 소유하므로 솔버 인스턴스는 스레드당 하나.
+// - set_two_threads(true): 후진 방향을 솔버가 가진 2워커 ThreadPool의 상주 워커에서 동시에 진행
+//   (쿼리마다 스레드를 만들지 않음, 긴 쿼리용). 상대 방향 g는 SharedLabels로 읽고 종료 판단은 공개된 마지막 키로 한다.
+// - stats: expanded/pushes/pops는 두 방향 합, peak_open은 두 큐 peak의 합.
+template <class Queue = BinaryHeap<int,double>>
+class BidirectionalT {
+public:
+  void set_two_threads(bool on) {
+    two_threads_ = on;
+    if (on && !pair_pool_) pair_pool_ = std::make_unique<ThreadPool>(2);
+  }
+  bool two_threads() const { return two_threads_; }
+
+  PathResult solve(const GridMap& map,
+                   int sx, int sy, int gx, int gy,
+                   bool allow_diagonal = true,
+                   Heuristic H = make_heuristic("auto", /*allow_diagonal=*/true)) {
+    SearchContext ctx;
+    return solve(ctx, map, sx, sy, gx, gy, allow_diagonal, std::move(H));
+  }
+
+  // ctx(전진 방향)를 쿼리 간 재사용 (O(1) 리셋)
+  PathResult solve(SearchContext& ctx, const GridMap& map,
+                   int sx, int sy, int gx, int gy,
+                   bool allow_diagonal = true,
+                   Heuristic H = make_heuristic("auto", /*allow_diagonal=*/true)) {
+    return dispatch_heuristic(H, [&](auto hp) {
+      return solve(ctx, map, sx, sy, gx, gy, allow_diagonal, hp);
+    });
+  }
+
+  template <HeuristicPolicy HP>
+  PathResult solve(SearchContext& ctx, const GridMap& map,
+                   int sx, int sy, int gx, int gy,
+                   bool allow_diagonal, HP hp) {
+    PathResult r;
+
+    const int W = map.width(), Ht = map.height();
+    if (W<=0 || Ht<=0) return r;
+    if (sx<0||sy<0||gx<0||gy<0||sx>=W||gx>=W||sy>=Ht||gy>=Ht) return r;
+    if (!map.is_free(sx,sy) || !map.is_free(gx,gy)) return r;
+
+    const int N = map.padded_size();
+    const int sId = map.to_padded(sx,sy), gId = map.to_padded(gx,gy);
+
+    if (sId == gId) {
+      r.found = true;
+      r.path.push_back(map.from_padded(sId));
+      return r;
+    }
+
+    const double INF = std::numeric_limits<double>::infinity();
+    auto t0 = std::chrono::steady_clock::now();
+    ctx.begin((size_t)N);
+    back_.begin((size_t)N);
+    SearchContext* C[2] = { &ctx, &back_ };
+
+    Queue* open = open_;   // 멤버 큐 재사용 (비우기만, 버퍼 유지)
+    open[0].clear(); open[1].clear();
+    if constexpr (requires { open[0].reserve(size_t{}); }) {
+      open[0].reserve((size_t)N); open[1].reserve((size_t)N);
+    }
+
+    // 이동 규칙이 대칭(corner-cutting 금지 포함)이므로 후진 방향도 같은 격자 뷰 사용
+    const GridGraph graph(map, allow_diagonal);
+
+    // 균형 포텐셜 (d=0: +pf, d=1: -pf)
+    const double c = 0.5 * hp(sx,sy,gx,gy);
+    const double SG[2] = { +1.0, -1.0 };
+    auto pot = [&](int x, int y) { return 0.5 * (hp(x,y,gx,gy) - hp(x,y,sx,sy)); };
+    auto key = [&](int d, int v) {
+      return C[d]->g(v) + SG[d] * pot(map.padded_x(v), map.padded_y(v)) + c;
+    };
+
+    // μ와 만나는 간선 (a: 전진 쪽 노드, b: 후진 쪽 노드)
+    std::atomic<double> mu{INF};
+    std::mutex mu_m;
+    int meet_a = -1, meet_b = -1;
+    auto offer = [&](double cand, int a, int b) {
+      if (!(cand < mu.load())) return;
+      std::lock_guard<std::mutex> lk(mu_m);
+      if (cand < mu.load()) { mu.store(cand); meet_a = a; meet_b = b; }
+    };
+
+    C[0]->set(sId, 0.0, -1);
+    C[1]->set(gId, 0.0, -1);
+    open[0].push(sId, key(0, sId));
+    open[1].push(gId, key(1, gId));
+
+    const bool par = two_threads_;
+    if (par) {
+      pub_[0].begin((size_t)N); pub_[1].begin((size_t)N);
+      pub_[0].set(sId, 0.0);    pub_[1].set(gId, 0.0);
+    }
+
+    uint64_t expanded[2] = {0, 0};
+    double last[2] = { -INF, -INF };   // 방향별 마지막 pop 키 (단조)
+
+    // stale 항목을 건너뛰고 다음 노드 pop (없으면 -1)
+    auto pop_live = [&](int d) -> int {
+      while (!open[d].empty()) {
+        const int u = *open[d].pop();
+        if (!C[d]->closed(u)) return u;
+      }
+      return -1;
+    };
+
+    // u 확장: 상대 방향 라벨이 있는 이웃이면 μ 후보 갱신
+    auto scan = [&](int d, int u) {
+      SearchContext& S = *C[d];
+      S.close(u);
+      ++expanded[d];
+
+      const int ux = map.padded_x(u), uy = map.padded_y(u);
+      const double gu = S.g(u);
+      graph.for_each_move(u, [&](int k, int v, double w) {
+        const double ng = gu + w;
+
+        const double go = par ? pub_[1-d].get(v) : C[1-d]->g(v);
+        if (go < INF) {
+          if (d == 0) offer(ng + go, u, v);
+          else        offer(ng + go, v, u);
+        }
+
+        if (S.closed(v)) return;
+        if (ng < S.g(v)) {
+          S.set(v, ng, u);
+          if (par) pub_[d].set(v, ng);
+          open[d].push(v, ng + SG[d] * pot(ux+DIR_DX[k], uy+DIR_DY[k]) + c);
+        }
+      });
+    };
+
+    if (!par) {
+      for (;;) {
+        const int d = open[1].size() < open[0].size() ? 1 : 0;
+        const int u = pop_live(d);
+        if (u < 0) break;              // 한쪽이 소진되면 μ가 확정
+        last[d] = std::max(last[d], key(d, u));
+        if (last[0] + last[1] >= mu.load() + 2*c) break;
+        scan(d, u);
+      }
+    } else {
+      // 공개 키는 해당 노드 확장이 끝난 뒤에만 갱신 → 상대는 항상 보수적인(작은) 값을 본다
+      std::atomic<double> last_pub[2] = { -INF, -INF };
+      std::atomic<bool> done{false};
+      auto run = [&](int d) {
+        while (!done.load(std::memory_order_relaxed)) {
+          const int u = pop_live(d);
+          if (u < 0) break;
+          last[d] = std::max(last[d], key(d, u));
+          const double other = last_pub[1-d].load();  // μ보다 먼저 읽는다
+          const double bound = mu.load();
+          if (last[d] + other >= bound + 2*c) break;
+          scan(d, u);
+          last_pub[d].store(last[d]);
+        }
+        done.store(true);
+      };
+      // 호출 스레드 = 워커 0 (전진), 상주 워커 1 (후진). 먼저 끝난 쪽이 남은 청크를 가져가도
+      // done이 서 있으면 바로 빠져나온다.
+      pair_pool_->parallel_for(2, 1, [&](unsigned, size_t d) { run((int)d); });
+    }
+
+    auto t1 = std::chrono::steady_clock::now();
+    r.stats.millis    = std::chrono::duration<double,std::milli>(t1-t0).count();
+    r.stats.expanded  = expanded[0] + expanded[1];
+    r.stats.pushes    = open[0].push_count() + open[1].push_count();
+    r.stats.pops      = open[0].pop_count()  + open[1].pop_count();
+    r.stats.peak_open = open[0].peak_size()  + open[1].peak_size();
+
+    if (mu.load() == INF) { r.found=false; return r; }
+    r.found = true;
+    r.cost  = mu.load();
+
+    // 경로 복원: s → meet_a (전진 parent 역순), meet_b → t (후진 parent)
+    std::vector<int> rev;
+    for (int v=meet_a; v!=-1; v=C[0]->parent(v)) rev.push_back(map.from_padded(v));
+    r.path.assign(rev.rbegin(), rev.rend());
+    for (int v=meet_b; v!=-1; v=C[1]->parent(v)) r.path.push_back(map.from_padded(v));
+    return r;
+  }
+
+private:
+  SearchContext back_;               // 후진 방향 작업공간
+  Queue open_[2];                    // 방향별 큐 (쿼리 간 재사용)
+  detail::SharedLabels pub_[2];      // 두 스레드 모드 전용
+  bool two_threads_{false};
+  std::unique_ptr<ThreadPool> pair_pool_;   // 두 스레드 모드: 후진 방향을 맡는 상주 워커
+};
+
+using Bidirectional = BidirectionalT<>;
+
+} // namespace pathlab
@@ -0,0 +1,138 @@
+#pragma once
+#include <vector>
+#include <limits>
+#include <chrono>
+#include <algorithm>
+#include "pathlab/algorithms/ipathfinder.hpp"
+#include "pathlab/algorithms/search_context.hpp"
+#include "pathlab/core/csr_graph.hpp"
+#include "pathlab/core/contraction_hierarchy.hpp"
+#include "pathlab/queues/binary_heap.hpp"
+
+namespace pathlab {
+
+// CH 질의: 상향 간선만 따라가는 양방향 Dijkstra (그래프가 대칭이라 두 방향 모두 같은 상향 CSR)
+// - 한 방향의 pop 키(= g)가 지금까지의 최단 μ 이상이면 그 방향 종료. 두 방향이 번갈아 pop.
+// - stall-on-demand: 더 높은 이웃 x에서 g(x)+w < g(u)면 u는 최단이 아니므로 확장하지 않는다.
+// - 경로: 만난 노드까지 두 parent 사슬을 shortcut 펼치기로 원래 간선 열로 복원.
+//   cost는 펼친 경로를 출발점부터 순서대로 더한 값 (격자 Dijkstra의 g 누적과 같은 방식).
+// - 후진 탐색 작업공간은 솔버가 소유하므로 솔버 인스턴스는 스레드당 하나.
+template <class Queue = BinaryHeap<int,double>>
+class CHQueryT {
+public:
+  CHQueryT() = default;
+  CHQueryT(const ContractionHierarchy* ch, const CsrGraph* graph) : ch_(ch), graph_(graph) {}
+
+  // 격자 좌표 질의 (graph가 from_grid로 만든 그래프여야 함). path는 노드ID y*W+x
+  PathResult solve(SearchContext& ctx, int sx, int sy, int gx, int gy) {
+    const int32_t s = graph_->node_at(sx, sy), t = graph_->node_at(gx, gy);
+    if (s < 0 || t < 0) return PathResult{};
+    PathResult r = solve_nodes(ctx, (uint32_t)s, (uint32_t)t);
+    for (int& v : r.path) v = graph_->grid_id((uint32_t)v);
+    return r;
+  }
+
+  // 그래프 노드 질의 (path는 그래프 노드 ID)
+  PathResult solve_nodes(SearchContext& ctx, uint32_t s, uint32_t t) {
+    PathResult r;
+    const ContractionHierarchy& CH = *ch_;
+    const uint32_t n = CH.node_count();
+    if (s >= n || t >= n) return r;
+
+    const double INF = std::numeric_limits<double>::infinity();
+    auto t0 = std::chrono::steady_clock::now();
+    SearchContext* side[2] = { &ctx, &bwd_ };
+    Queue* open = open_;   // 멤버 큐 재사용 (비우기만, 버퍼 유지)
+    bool active[2] = { true, true };
+    for (int d = 0; d < 2; ++d) {
+      side[d]->begin(n);
+      open[d].clear();
+      if constexpr (requires { open[d].reserve(size_t{}); }) open[d].reserve(n);
+    }
+    ctx.set((int)s, 0.0, -1);  open[0].push((int)s, 0.0);
+    bwd_.set((int)t, 0.0, -1); open[1].push((int)t, 0.0);
+    double best = s == t ? 0.0 : INF;
+    int meet = s == t ? (int)s : -1;
+    uint64_t expanded = 0;
+
+    for (int d = 0; active[0] || active[1]; d ^= 1) {
+      if (!active[d]) continue;
+      SearchContext& me = *side[d];
+      SearchContext& other = *side[d ^ 1];
+      int u = -1;
+      while (!open[d].empty()) {
+        const int x = *open[d].pop();
+        if (!me.closed(x)) { u = x; break; }
+      }
+      if (u < 0) { active[d] = false; continue; }
+      const double gu = me.g(u);
+      if (gu >= best) { active[d] = false; continue; }
+      me.close(u);
+
+      if (other.seen(u) && gu + other.g(u) < best) { best = gu + other.g(u); meet = u; }
+
+      // stall-on-demand
+      bool stalled = false;
+      for (const auto* a = CH.up_begin((uint32_t)u); a != CH.up_end((uint32_t)u); ++a)
+        if (me.g((int)a->to) + a->w < gu) { stalled = true; break; }
+      if (stalled) continue;
+
+      ++expanded;
+      for (const auto* a = CH.up_begin((uint32_t)u); a != CH.up_end((uint32_t)u); ++a) {
+        const int v = (int)a->to;
+        if (me.closed(v)) continue;
+        const double ng = gu + a->w;
+        if (ng < me.g(v)) { me.set(v, ng, u); open[d].push(v, ng); }
+      }
+    }
+
+    r.stats.expanded  = expanded;
+    r.stats.pushes    = open[0].push_count() + open[1].push_count();
+    r.stats.pops      = open[0].pop_count() + open[1].pop_count();
+    r.stats.peak_open = open[0].peak_size() + open[1].peak_size();
+
+    if (meet < 0) {
+      r.stats.millis = std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now()-t0).count();
+      return r;
+    }
+
+    // 상향 사슬: s … meet (정방향), t … meet (역방향)
+    chain_.clear();
+    for (int v = meet; v != -1; v = ctx.parent(v)) chain_.push_back((uint32_t)v);
+    std::reverse(chain_.begin(), chain_.end());
+    for (int v = bwd_.parent(meet); v != -1; v = bwd_.parent(v)) chain_.push_back((uint32_t)v);
+
+    nodes_.clear();
+    nodes_.push_back(chain_[0]);
+    double cost = 0.0;
+    for (size_t i = 1; i < chain_.size(); ++i) {
+      const uint32_t a = chain_[i - 1], b = chain_[i];
+      CH.unpack(a, b, arc_mid(a, b), nodes_, cost);
+    }
+
+    r.found = true;
+    r.cost  = cost;
+    r.path.assign(nodes_.begin(), nodes_.end());
+    r.stats.millis = std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now()-t0).count();
+    return r;
+  }
+
+private:
+  const ContractionHierarchy* ch_{nullptr};
+  const CsrGraph* graph_{nullptr};
+  SearchContext bwd_;
+  Queue open_[2];
+  std::vector<uint32_t> chain_, nodes_;
+
+  // 사슬의 인접 두 노드를 잇는 상향 간선의 mid (낮은 순위 쪽 목록에 있다)
+  uint32_t arc_mid(uint32_t a, uint32_t b) const {
+    const ContractionHierarchy& CH = *ch_;
+    const uint32_t lo = CH.rank(a) < CH.rank(b) ? a : b, hi = lo == a ? b : a;
+    for (const auto* e = CH.up_begin(lo); e != CH.up_end(lo); ++e) if (e->to == hi) return e->mid;
+    return ContractionHierarchy::kNoMid;
+  }
+};
+
+using CHQuery = CHQueryT<>;
+
+} // namespace pathlab
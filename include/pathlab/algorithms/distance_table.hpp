@@ -0,0 +1,119 @@
+#pragma once
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <chrono>
+#include <cstdint>
+#include "pathlab/algorithms/dijkstra.hpp"
+#include "pathlab/algorithms/search_context.hpp"
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/queues/binary_heap.hpp"
+#include "pathlab/util/thread_pool.hpp"
+
+namespace pathlab {
+
+// 한 출발점 → 여러 목표 거리 (Dijkstra 한 번)
+// - 목표 칸에 세대 스탬프로 표시하고, 아직 확정 안 된 서로 다른 목표가 모두 pop되면 종료.
+// - 반환 dist[i]는 targets[i]까지 최단 거리 (도달 불가/범위 밖/장애물이면 INF).
+// - 목표 표시 배열은 인스턴스가 소유 → 인스턴스는 스레드당 하나 (작업공간 재사용).
+template <class Queue = BinaryHeap<int,double>>
+class DistanceTableT {
+public:
+  std::vector<double> one_to_many(const GridMap& map, Coord source, const std::vector<Coord>& targets,
+                                  bool allow_diagonal = true, SearchStats* stats = nullptr) {
+    return one_to_many(ctx_, map, source, targets, allow_diagonal, stats);
+  }
+
+  // ctx를 쿼리 간 재사용 (O(1) 리셋)
+  std::vector<double> one_to_many(SearchContext& ctx, const GridMap& map, Coord source,
+                                  const std::vector<Coord>& targets,
+                                  bool allow_diagonal = true, SearchStats* stats = nullptr) {
+    std::vector<double> dist(targets.size(), INF);
+    if (stats) *stats = SearchStats{};
+    if (!map.is_free(source.x, source.y)) return dist;
+
+    begin_marks((size_t)map.padded_size());
+    size_t remaining = 0;
+    for (const Coord& t : targets) {
+      if (!map.is_free(t.x, t.y)) continue;
+      const int p = map.to_padded(t.x, t.y);
+      if (mark_[p] != epoch_) { mark_[p] = epoch_; ++remaining; }
+    }
+    if (remaining == 0) return dist;
+
+    const SearchStats st = core_.sweep(ctx, map, map.to_padded(source.x, source.y), 0, 0,
+                                       allow_diagonal, ZeroH{}, [&](int u) {
+      if (mark_[u] != epoch_) return false;
+      mark_[u] = 0;               // 확정 (중복 목표는 한 번만 센다)
+      return --remaining == 0;
+    });
+    if (stats) *stats = st;
+
+    for (size_t i = 0; i < targets.size(); ++i)
+      if (map.is_free(targets[i].x, targets[i].y)) dist[i] = ctx.g(map.to_padded(targets[i].x, targets[i].y));
+    return dist;
+  }
+
+private:
+  static constexpr double INF = std::numeric_limits<double>::infinity();
+
+  void begin_marks(size_t n) {
+    if (mark_.size() < n) mark_.resize(n, 0);
+    if (++epoch_ == 0) { std::fill(mark_.begin(), mark_.end(), 0u); epoch_ = 1; }
+  }
+
+  DijkstraT<Queue> core_;
+  SearchContext ctx_;
+  std::vector<uint32_t> mark_;  // mark_[p] == epoch_ : 아직 확정 안 된 목표
+  uint32_t epoch_{0};
+};
+
+using DistanceTable = DistanceTableT<>;
+
+// 출발점 × 목표 거리 행렬 (row-major)
+struct DistanceMatrix {
+  size_t rows{0}, cols{0};
+  std::vector<double> d;
+  SearchStats stats;          // expanded/pushes/pops는 행 합, peak_open은 최대, millis는 벽시계
+  double at(size_t i, size_t j) const { return d[i * cols + j]; }
+};
+
+// 행렬 모드: 출발점을 ThreadPool 워커에 나눠 one_to_many 실행
+// - 워커별 DistanceTableT(작업공간 포함)를 멤버로 두고 호출 간에도 재사용.
+template <class Queue = BinaryHeap<int,double>>
+class DistanceMatrixT {
+public:
+  DistanceMatrix compute(ThreadPool& pool, const GridMap& map,
+                         const std::vector<Coord>& sources, const std::vector<Coord>& targets,
+                         bool allow_diagonal = true) {
+    if (workers_.size() < pool.size()) workers_.resize(pool.size());
+    DistanceMatrix M;
+    M.rows = sources.size();
+    M.cols = targets.size();
+    M.d.assign(M.rows * M.cols, std::numeric_limits<double>::infinity());
+    std::vector<SearchStats> row_stats(M.rows);
+
+    auto t0 = std::chrono::steady_clock::now();
+    pool.parallel_for(M.rows, /*grain=*/1, [&](unsigned w, size_t i) {
+      std::vector<double> row = workers_[w].one_to_many(map, sources[i], targets,
+                                                        allow_diagonal, &row_stats[i]);
+      std::copy(row.begin(), row.end(), M.d.begin() + i * M.cols);
+    });
+    M.stats.millis = std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now() - t0).count();
+
+    for (const SearchStats& s : row_stats) {
+      M.stats.expanded += s.expanded;
+      M.stats.pushes   += s.pushes;
+      M.stats.pops     += s.pops;
+      M.stats.peak_open = std::max(M.stats.peak_open, s.peak_open);
+    }
+    return M;
+  }
+
+private:
+  std::vector<DistanceTableT<Queue>> workers_;
+};
+
+using DistanceMatrixBuilder = DistanceMatrixT<>;
+
+} // namespace pathlab
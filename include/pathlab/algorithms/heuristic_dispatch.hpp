@@ -0,0 +1,39 @@
+#pragma once
+#include <algorithm>
+#include <string>
+#include "pathlab/util/heuristic_factory.hpp"
+#include "pathlab/core/landmark_table.hpp"
+
+namespace pathlab {
+
+// 랜드마크(ALT)까지 아는 휴리스틱 생성/디스패치. util은 core에 의존하지 않으므로
+// 테이블이 필요한 부분(AltH, 이름 "alt")은 이 층에 둔다.
+
+// 문자열→Heuristic: "alt"는 landmarks가 있고 이동 규칙이 같을 때만, 아니면 util 버전(auto 등)으로
+inline Heuristic make_heuristic(const std::string& name, bool allow_diagonal,
+                                const LandmarkTable* landmarks){
+    std::string s = name;
+    std::transform(s.begin(), s.end(), s.begin(), ::tolower);
+    if ((s=="alt" || s=="landmark") && landmarks && !landmarks->empty()
+        && landmarks->allow_diagonal() == allow_diagonal)
+        return make_alt_heuristic(*landmarks);
+    return make_heuristic(name, allow_diagonal);
+}
+
+// 런타임 Heuristic → 정책 functor로 한 번 디스패치하여 f(policy) 호출.
+// 배치(시나리오 묶음) 단위로 호출하면 노드당 간접 호출이 사라진다.
+template <class F>
+decltype(auto) dispatch_heuristic(const Heuristic& H, F&& f){
+    switch(H.type){
+        case HeuType::Zero:      return f(heuristic_for_t<HeuType::Zero>{});
+        case HeuType::Manhattan: return f(heuristic_for_t<HeuType::Manhattan>{});
+        case HeuType::Euclidean: return f(heuristic_for_t<HeuType::Euclidean>{});
+        case HeuType::Octile:    return f(heuristic_for_t<HeuType::Octile>{});
+        case HeuType::Alt:
+            if (H.landmarks) return f(AltH{ H.landmarks });
+            return f(FunctionH{ &H.h });
+        default:                 return f(FunctionH{ &H.h });
+    }
+}
+
+} // namespace pathlab
@@ -0,0 +1,167 @@
+#pragma once
+#include <vector>
+#include <limits>
+#include <chrono>
+#include <utility>
+#include <algorithm>
+#include "pathlab/algorithms/ipathfinder.hpp"
+#include "pathlab/algorithms/search_context.hpp"
+#include "pathlab/algorithms/astar.hpp"
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/core/hierarchical_graph.hpp"
+#include "pathlab/queues/binary_heap.hpp"
+#include "pathlab/util/heuristic_octile.hpp"
+#include "pathlab/util/heuristic_manhattan.hpp"
+
+namespace pathlab {
+
+// HPA* (근사): HierarchicalGraph 위에서 추상 A* → (선택) 클러스터 안 경로로 정제
+// - start/goal 삽입: 각자 클러스터 안 Dijkstra로 그 클러스터 노드까지 거리 (임시 노드 S, G).
+//   같은 클러스터면 클러스터 안 직접 경로도 S→G 간선으로 넣는다.
+// - 추상 탐색: 노드 ID [0,N) + S=N, G=N+1, h = 노드 칸에서 goal까지 옥타일(4방이면 맨해튼).
+// - cost = 추상 경로 비용 (intra 간선은 클러스터 안 최단 거리라 정제해도 같은 값).
+//   경로가 entrance를 거쳐야 하므로 최적보다 길 수 있다.
+// - 정제(refine): 같은 클러스터 구간은 클러스터 안 최단 경로, inter 간선은 한 칸 이동으로 채워
+//   전체 노드ID 열을 만든다. 끄면 path는 [start, 추상 노드 칸..., goal].
+// - 그래프가 없거나 이동 규칙이 다르면 정확한 A*로 대체.
+// - stats.expanded = 추상 확장 + 삽입/정제의 클러스터 안 확장.
+template <class Queue = BinaryHeap<int,double>>
+class HPAStarT {
+public:
+  HPAStarT() = default;
+  explicit HPAStarT(const HierarchicalGraph* graph, bool refine = true) : graph_(graph), refine_(refine) {}
+
+  void set_refine(bool on) { refine_ = on; }
+
+  PathResult solve(const GridMap& map, int sx, int sy, int gx, int gy, bool allow_diagonal = true) {
+    SearchContext ctx;
+    return solve(ctx, map, sx, sy, gx, gy, allow_diagonal);
+  }
+
+  // ctx: 추상 탐색용 (쿼리 간 재사용), 클러스터 안 탐색은 인스턴스 작업공간
+  PathResult solve(SearchContext& ctx, const GridMap& map, int sx, int sy, int gx, int gy,
+                   bool allow_diagonal = true) {
+    if (!graph_ || graph_->empty() || graph_->allow_diagonal() != allow_diagonal) {
+      if (allow_diagonal) return ast_.solve(ctx, map, sx, sy, gx, gy, true, OctileH{});
+      return ast_.solve(ctx, map, sx, sy, gx, gy, false, ManhattanH{});
+    }
+    if (allow_diagonal) return run(ctx, map, sx, sy, gx, gy, OctileH{});
+    return run(ctx, map, sx, sy, gx, gy, ManhattanH{});
+  }
+
+private:
+  const HierarchicalGraph* graph_{nullptr};
+  bool refine_{true};
+  HierarchicalGraph::LocalWorkspace local_;
+  Queue open_;                   // 추상 A* 큐 (쿼리 간 재사용)
+  AStarT<Queue> ast_;            // 그래프 없음/연결성 불일치 시 대체
+  std::vector<int>    cl_cells_;
+  std::vector<double> sdist_, gdist_;
+  std::vector<int>    abs_path_;
+
+  template <class HP>
+  PathResult run(SearchContext& ctx, const GridMap& map, int sx, int sy, int gx, int gy, HP hp) {
+    PathResult r;
+    const HierarchicalGraph& G = *graph_;
+    const int W = map.width(), Ht = map.height();
+    if (W<=0 || Ht<=0) return r;
+    if (sx<0||sy<0||gx<0||gy<0||sx>=W||gx>=W||sy>=Ht||gy>=Ht) return r;
+    if (!map.is_free(sx,sy) || !map.is_free(gx,gy)) return r;
+
+    const double INF = std::numeric_limits<double>::infinity();
+    auto t0 = std::chrono::steady_clock::now();
+    const int sP = map.to_padded(sx,sy), gP = map.to_padded(gx,gy);
+    if (sP == gP) {
+      r.found = true;
+      r.path.push_back(sy * W + sx);
+      return r;
+    }
+    const int sc = G.cluster_of(sx,sy), gc = G.cluster_of(gx,gy);
+    const int sb = G.cluster_begin(sc), se = G.cluster_begin(sc + 1);
+    const int gb = G.cluster_begin(gc), ge = G.cluster_begin(gc + 1);
+    uint64_t local_expanded = 0;
+
+    // ---- 삽입: 클러스터 노드까지 거리 (같은 클러스터면 goal 칸도 목표) ----
+    cl_cells_.clear();
+    for (int i = sb; i < se; ++i) cl_cells_.push_back(G.node_cell(i));
+    if (sc == gc) cl_cells_.push_back(gP);
+    sdist_.resize(cl_cells_.size());
+    local_expanded += G.local_search(local_, map, sP, sc, cl_cells_.data(), cl_cells_.size(), sdist_.data());
+    const double direct = sc == gc ? sdist_.back() : INF;
+
+    cl_cells_.clear();
+    for (int i = gb; i < ge; ++i) cl_cells_.push_back(G.node_cell(i));
+    gdist_.resize(cl_cells_.size());
+    local_expanded += G.local_search(local_, map, gP, gc, cl_cells_.data(), cl_cells_.size(), gdist_.data());
+
+    // ---- 추상 A* ----
+    const int N = (int)G.node_count(), S = N, T = N + 1;
+    ctx.begin((size_t)N + 2);
+    Queue& open = open_;
+    open.clear();
+    if constexpr (requires { open.reserve(size_t{}); }) open.reserve((size_t)N + 2);
+    ctx.set(S, 0.0, -1);
+    open.push(S, hp(sx,sy,gx,gy));
+    uint64_t expanded = 0;
+
+    auto relax = [&](int v, double ng, int u) {
+      if (ctx.closed(v) || !(ng < ctx.g(v))) return;
+      ctx.set(v, ng, u);
+      const int vc = v == T ? gP : G.node_cell(v);
+      open.push(v, ng + (v == T ? 0.0 : hp(map.padded_x(vc), map.padded_y(vc), gx, gy)));
+    };
+
+    while (!open.empty()) {
+      const int u = *open.pop();
+      if (ctx.closed(u)) continue;
+      if (u == T) break;
+      ctx.close(u);
+      ++expanded;
+      const double gu = ctx.g(u);
+      if (u == S) {
+        for (int i = sb; i < se; ++i)
+          if (sdist_[i - sb] < INF) relax(i, sdist_[i - sb], S);
+        if (direct < INF) relax(T, direct, S);
+        continue;
+      }
+      for (const auto* e = G.edges_begin(u); e != G.edges_end(u); ++e) relax(e->to, gu + e->w, u);
+      if (u >= gb && u < ge && gdist_[u - gb] < INF) relax(T, gu + gdist_[u - gb], u);
+    }
+
+    r.stats.expanded  = expanded;
+    r.stats.pushes    = open.push_count();
+    r.stats.pops      = open.pop_count();
+    r.stats.peak_open = open.peak_size();
+
+    if (ctx.g(T) == INF) {
+      r.stats.expanded += local_expanded;
+      r.stats.millis = std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now()-t0).count();
+      return r;
+    }
+    r.found = true;
+    r.cost  = ctx.g(T);
+
+    // ---- 추상 경로 → 칸 열 ----
+    abs_path_.clear();
+    for (int v = T; v != -1; v = ctx.parent(v))
+      abs_path_.push_back(v == S ? sP : v == T ? gP : G.node_cell(v));
+    std::reverse(abs_path_.begin(), abs_path_.end());
+
+    r.path.push_back(map.from_padded(sP));
+    for (size_t i = 1; i < abs_path_.size(); ++i) {
+      const int a = abs_path_[i - 1], b = abs_path_[i];
+      const int ca = G.cluster_of(map.padded_x(a), map.padded_y(a));
+      const int cb = G.cluster_of(map.padded_x(b), map.padded_y(b));
+      if (refine_ && ca == cb) G.local_path(local_, map, a, b, ca, r.path, &local_expanded);
+      else if (a != b) r.path.push_back(map.from_padded(b)); // inter 간선 (또는 정제 생략)
+    }
+
+    r.stats.expanded += local_expanded;
+    r.stats.millis = std::chrono::duration<double,std::milli>(std::chrono::steady_clock::now()-t0).count();
+    return r;
+  }
+};
+
+using HPAStar = HPAStarT<>;
+
+} // namespace pathlab
@@ -8,6 +8,7 @@ struct SearchStats {
   uint64_t expanded{0};
   uint64_t pushes{0};  
   uint64_t pops{0};    
+  uint64_t peak_open{0}; // open list 최대 크기 (큐 peak_size)
   double millis{0.0};
 };
 
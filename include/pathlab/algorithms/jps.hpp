@@ -0,0 +1,244 @@
+#pragma once
+#include <vector>
+#include <limits>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <bit>
+#include <algorithm>
+#include "pathlab/algorithms/ipathfinder.hpp"
+#include "pathlab/algorithms/search_context.hpp"
+#include "pathlab/algorithms/astar.hpp"
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/core/jump_table.hpp"
+#include "pathlab/queues/binary_heap.hpp"
+#include "pathlab/util/heuristic_octile.hpp"
+#include "pathlab/util/heuristic_manhattan.hpp"
+
+namespace pathlab {
+
+// Jump Point Search (균일 비용 8방 격자, corner-cutting 금지 변형)
+// - 이동 규칙/비용은 AStar와 동일 (직교=1, 대각=√2, 대각은 양옆 직교 칸이 모두 free일 때만).
+// - 직선 점프: 진행 방향 옆 칸이 free인데 그 칸의 "뒤쪽"이 막혀 있으면 jump point (강제 이웃).
+// - 대각 점프: 각 칸에서 두 직교 성분 방향으로 직선 점프가 무언가를 찾으면 jump point.
+// - 가지치기: 대각 진입 → (dx,0),(0,dy),(dx,dy) / 직선 진입 → 되돌아가는 x(또는 y) 성분만 제외.
+// - 확장/push는 jump point만, 경로는 jump point 사이 칸을 채워 전체 노드ID 열로 복원.
+// - allow_diagonal=false면 JPS 규칙이 달라지므로 맨해튼 A*로 대체.
+// 점프 방식:
+// - 기본: 행/열 64비트 비트보드에서 (막힘 | 강제 이웃 | goal) 후보를 ctz/clz로 한 번에 찾는다.
+// - JumpTable(JPS+) 지정 시: 셀·방향별 전처리 거리로 O(1) 점프. goal이 진행 범위 안에
+//   있으면 goal(직선) 또는 goal과 행/열이 맞는 대각 칸(target jump point)에서 멈춘다.
+template <class Queue = BinaryHeap<int,double>>
+class JPST {
+public:
+  JPST() = default;
+  explicit JPST(const JumpTable* table) : table_(table) {}
+
+  PathResult solve(const GridMap& map, int sx, int sy, int gx, int gy, bool allow_diagonal = true) {
+    SearchContext ctx;
+    return solve(ctx, map, sx, sy, gx, gy, allow_diagonal);
+  }
+
+  // ctx를 쿼리 간 재사용 (O(1) 리셋)
+  PathResult solve(SearchContext& ctx, const GridMap& map, int sx, int sy, int gx, int gy,
+                   bool allow_diagonal = true) {
+    if (!allow_diagonal) {
+      return ast_.solve(ctx, map, sx, sy, gx, gy, false, ManhattanH{});
+    }
+
+    PathResult r;
+
+    const int W = map.width(), H = map.height();
+    if (W<=0 || H<=0) return r;
+    if (sx<0||sy<0||gx<0||gy<0||sx>=W||gx>=W||sy>=H||gy>=H) return r;
+    if (!map.is_free(sx,sy) || !map.is_free(gx,gy)) return r;
+
+    // 내부 탐색은 패딩 ID 공간 (범위 검사 없음)
+    const int N = map.padded_size();
+    const int PW = map.padded_width();
+
+    const double INF = std::numeric_limits<double>::infinity();
+    auto t0 = std::chrono::steady_clock::now();
+    ctx.begin((size_t)N);
+
+    Queue& open = open_;   // 멤버 큐 재사용 (비우기만, 버퍼 유지)
+    open.clear();
+    if constexpr (requires { open.reserve(size_t{}); }) open.reserve((size_t)N); // 인덱스 큐 위치 맵
+
+    const int sId = map.to_padded(sx,sy), gId = map.to_padded(gx,gy);
+    ctx.set(sId, 0.0, -1);
+    open.push(sId, h_octile(sx,sy,gx,gy));
+
+    const uint8_t* NM = map.neighbor_masks();
+    int OFF[8];
+    for (int k=0;k<8;++k) OFF[k] = DIR_DX[k] + DIR_DY[k]*PW;
+
+    const int RW = map.row_words(), CW = map.col_words();
+    const int gpx = gx + 1, gpy = gy + 1; // goal 패딩 좌표
+
+    // 직선 점프 (비트보드): 패딩 좌표 (px,py)에서 방향 k(<4). jump point(또는 goal) ID, 없으면 -1.
+    auto jump_straight = [&](int px, int py, int k) -> int {
+      if (k < 2) {
+        const int goal = (py == gpy) ? gpx : -1;
+        const int x = (k == 0)
+          ? scan_fwd(map.row_bits(py), map.row_bits(py-1), map.row_bits(py+1), RW, px, goal)
+          : scan_bwd(map.row_bits(py), map.row_bits(py-1), map.row_bits(py+1), RW, px, goal);
+        return x < 0 ? -1 : py*PW + x;
+      } else {
+        const int goal = (px == gpx) ? gpy : -1;
+        const int y = (k == 2)
+          ? scan_fwd(map.col_bits(px), map.col_bits(px-1), map.col_bits(px+1), CW, py, goal)
+          : scan_bwd(map.col_bits(px), map.col_bits(px-1), map.col_bits(px+1), CW, py, goal);
+        return y < 0 ? -1 : y*PW + px;
+      }
+    };
+
+    // 대각 점프: 방향 k(>=4). 각 칸에서 두 직교 성분으로 직선 점프를 시도.
+    auto jump_diagonal = [&](int p, int px, int py, int k) -> int {
+      const int kx = DIR_DX[k] > 0 ? 0 : 1;   // (±1,0) 방향 인덱스
+      const int ky = DIR_DY[k] > 0 ? 2 : 3;   // (0,±1) 방향 인덱스
+      for (;;) {
+        if (!((NM[p] >> k) & 1)) return -1;   // 대각 이동 불가 (corner-cutting 포함)
+        p += OFF[k]; px += DIR_DX[k]; py += DIR_DY[k];
+        if (p == gId) return p;
+        if (jump_straight(px, py, kx) != -1 || jump_straight(px, py, ky) != -1) return p;
+      }
+    };
+
+    // JPS+ 점프: 전처리 거리 + goal 목표점 처리
+    auto jump_table = [&](int p, int px, int py, int k) -> int {
+      const int d = table_->dist(p, k);
+      const int reach = d > 0 ? d : -d;
+      const int ddx = gpx - px, ddy = gpy - py;
+      if (k < 4) {
+        // goal이 같은 행/열, 진행 방향 앞쪽, 도달 범위 안
+        const int along = DIR_DX[k] ? ddx * DIR_DX[k] : ddy * DIR_DY[k];
+        const int across = DIR_DX[k] ? ddy : ddx;
+        if (across == 0 && along > 0 && along <= reach) return gId;
+      } else if (ddx * DIR_DX[k] > 0 && ddy * DIR_DY[k] > 0) {
+        const int md = std::min(std::abs(ddx), std::abs(ddy));
+        if (md <= reach) return p + md * OFF[k]; // goal과 행/열이 맞는 대각 칸
+      }
+      return d > 0 ? p + d * OFF[k] : -1;
+    };
+
+    auto sgn = [](int v) { return (v > 0) - (v < 0); };
+
+    uint64_t expanded = 0;
+
+    while (!open.empty()) {
+      int u = *open.pop();
+      if (ctx.closed(u)) continue;  // stale pop
+      if (u == gId) break;
+      ctx.close(u);
+
+      ++expanded;
+
+      const int ux = map.padded_x(u), uy = map.padded_y(u);
+      const double gu = ctx.g(u);
+
+      // 진입 방향에 따른 가지치기 (시작점은 전 방향)
+      unsigned dirs = 0xFFu;
+      const int pu = ctx.parent(u);
+      if (pu != -1) {
+        const int dx = sgn(ux - map.padded_x(pu)), dy = sgn(uy - map.padded_y(pu));
+        dirs = 0;
+        for (int k=0;k<8;++k) {
+          if (dx != 0 && dy != 0) {
+            if ((DIR_DX[k] == dx && DIR_DY[k] == 0) || (DIR_DX[k] == 0 && DIR_DY[k] == dy) ||
+                (DIR_DX[k] == dx && DIR_DY[k] == dy)) dirs |= 1u << k;
+          } else if (dx != 0) {
+            if (DIR_DX[k] != -dx) dirs |= 1u << k;
+          } else {
+            if (DIR_DY[k] != -dy) dirs |= 1u << k;
+          }
+        }
+      }
+
+      for (unsigned m = NM[u] & dirs; m; m &= m-1) {
+        const int k = std::countr_zero(m);
+        const int j = table_ ? jump_table(u, ux+1, uy+1, k)
+                    : (k < 4) ? jump_straight(ux+1, uy+1, k) : jump_diagonal(u, ux+1, uy+1, k);
+        if (j == -1 || ctx.closed(j)) continue;
+
+        const int jx = map.padded_x(j), jy = map.padded_y(j);
+        const int steps = std::abs(jx - ux) + std::abs(jy - uy);
+        const double ng = gu + (k < 4 ? double(steps) : (steps / 2) * SQRT2);
+        if (ng < ctx.g(j)) {
+          ctx.set(j, ng, u);
+          open.push(j, ng + h_octile(jx,jy,gx,gy));
+        }
+      }
+    }
+
+    auto t1 = std::chrono::steady_clock::now();
+    r.stats.millis    = std::chrono::duration<double,std::milli>(t1-t0).count();
+    r.stats.expanded  = expanded;
+    r.stats.pushes    = open.push_count();
+    r.stats.pops      = open.pop_count();
+    r.stats.peak_open = open.peak_size();
+
+    if (ctx.g(gId) == INF) { r.found=false; return r; }
+    r.found = true;
+    r.cost  = ctx.g(gId);
+
+    // 경로 복원: jump point 사이를 직선/대각 칸으로 채움
+    std::vector<int> rev;
+    for (int v=gId; v!=-1; ) {
+      rev.push_back(map.from_padded(v));
+      const int p = ctx.parent(v);
+      if (p == -1) break;
+      const int step = sgn(map.padded_x(p) - map.padded_x(v)) + sgn(map.padded_y(p) - map.padded_y(v)) * PW;
+      for (int c = v + step; c != p; c += step) rev.push_back(map.from_padded(c));
+      v = p;
+    }
+    r.path.assign(rev.rbegin(), rev.rend());
+    return r;
+  }
+
+private:
+  static constexpr double SQRT2 = 1.41421356237309504880;
+
+  // 라인 비트보드 스캔. F = 현재 라인(free=1), A/B = 양옆 라인, nw = 워드 수.
+  // from 다음(fwd) / 이전(bwd) 칸부터 첫 정지 위치: 막힌 칸이면 -1,
+  // 강제 이웃(옆 라인이 뒤 칸에서 막힘→현재 칸에서 열림) 또는 goal이면 그 위치.
+  static int scan_fwd(const uint64_t* F, const uint64_t* A, const uint64_t* B, int nw, int from, int goal) {
+    const int start = from + 1;
+    uint64_t lim = ~uint64_t(0) << (start & 63);
+    for (int i = start >> 6; i < nw; ++i) {
+      const uint64_t ap = i ? A[i-1] >> 63 : 0, bp = i ? B[i-1] >> 63 : 0;
+      uint64_t c = ~F[i] | (A[i] & ~((A[i] << 1) | ap)) | (B[i] & ~((B[i] << 1) | bp));
+      if (goal >= 0 && (goal >> 6) == i) c |= uint64_t(1) << (goal & 63);
+      c &= lim; lim = ~uint64_t(0);
+      if (c) {
+        const int pos = (i << 6) + std::countr_zero(c);
+        return ((F[pos >> 6] >> (pos & 63)) & 1) ? pos : -1;
+      }
+    }
+    return -1;
+  }
+
+  static int scan_bwd(const uint64_t* F, const uint64_t* A, const uint64_t* B, int nw, int from, int goal) {
+    const int start = from - 1;
+    uint64_t lim = ~uint64_t(0) >> (63 - (start & 63));
+    for (int i = start >> 6; i >= 0; --i) {
+      const uint64_t an = i+1 < nw ? A[i+1] << 63 : 0, bn = i+1 < nw ? B[i+1] << 63 : 0;
+      uint64_t c = ~F[i] | (A[i] & ~((A[i] >> 1) | an)) | (B[i] & ~((B[i] >> 1) | bn));
+      if (goal >= 0 && (goal >> 6) == i) c |= uint64_t(1) << (goal & 63);
+      c &= lim; lim = ~uint64_t(0);
+      if (c) {
+        const int pos = (i << 6) + 63 - std::countl_zero(c);
+        return ((F[pos >> 6] >> (pos & 63)) & 1) ? pos : -1;
+      }
+    }
+    return -1;
+  }
+
+  const JumpTable* table_{nullptr};
+  Queue open_;
+  AStarT<Queue> ast_;            // 4방 대체 경로
+};
+
+using JPS = JPST<>;
+
+} // namespace pathlab
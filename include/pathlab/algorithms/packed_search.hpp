@@ -0,0 +1,116 @@
+#pragma once
+#include <vector>
+#include <chrono>
+#include <bit>
+#include "pathlab/algorithms/ipathfinder.hpp"
+#include "pathlab/algorithms/best_first_search.hpp"
+#include "pathlab/algorithms/search_context.hpp"
+#include "pathlab/algorithms/packed_search_context.hpp"
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/core/graph.hpp"
+#include "pathlab/queues/binary_heap.hpp"
+#include "pathlab/util/heuristic_base.hpp"
+
+namespace pathlab {
+
+// 패킹 노드 레코드(packed_search_context.hpp) 위의 격자 최선 우선 탐색 (Dijkstra: ZeroH, A*: 그 밖의 정책)
+// - 루프는 BestFirstSearch와 같다 (lazy decrease-key + closed 검사, goal pop 시 종료).
+// - 부모는 이동 방향 코드로만 저장하고, 경로는 goal에서 off[dir]을 빼 가며 복원한다.
+// - Rec: FloatNodeRecord(float g) 또는 StepCountNodeRecord(직교/대각 이동 수).
+//   반환 비용은 복원 경로를 출발점부터 double로 다시 합산한 값 (격자 Dijkstra와 같은 합산 순서).
+// - 칸 수가 Rec::kMaxMoves를 넘는 맵은 이동 수가 넘칠 수 있어 같은 큐의 double g 엔진(SearchContext)으로 푼다.
+template <class Queue = BinaryHeap<int,double>, class Rec = FloatNodeRecord>
+class PackedGridSearchT {
+public:
+  using Context = PackedSearchContext<Rec>;
+
+  template <HeuristicPolicy HP>
+  PathResult solve(Context& ctx, const GridMap& map,
+                   int sx, int sy, int gx, int gy,
+                   bool allow_diagonal, HP hp) {
+    PathResult r;
+
+    const int W = map.width(), Ht = map.height();
+    if (W<=0 || Ht<=0) return r;
+    if (sx<0||sy<0||gx<0||gy<0||sx>=W||gx>=W||sy>=Ht||gy>=Ht) return r;
+    if (!map.is_free(sx,sy) || !map.is_free(gx,gy)) return r;
+    if ((uint64_t)W * (uint64_t)Ht > Rec::kMaxMoves)
+      return fallback_.solve(fallback_ctx_, map, sx, sy, gx, gy, allow_diagonal, hp);
+
+    auto t0 = std::chrono::steady_clock::now();
+    const GridGraph graph(map, allow_diagonal);
+    const int sId = map.to_padded(sx,sy), gId = map.to_padded(gx,gy);
+    ctx.begin(graph.node_count());
+
+    Queue& open = open_;   // 멤버 큐 재사용 (비우기만, 버퍼 유지)
+    open.clear();
+    if constexpr (requires { open.reserve(size_t{}); }) open.reserve(graph.node_count());
+
+    auto h = [&](int v) { return hp(map.padded_x(v), map.padded_y(v), gx, gy); };
+    ctx.set(sId, Rec::zero(), 0);
+    open.push(sId, h(sId));
+
+    uint64_t expanded = 0;
+
+    while (!open.empty()) {
+      int u = *open.pop();
+      if (ctx.closed(u)) continue;  // stale pop
+      if (u == gId) break;
+      ctx.close(u);
+
+      ++expanded;
+
+      const typename Rec::Cost cu = ctx.cost(u);
+      for (unsigned m = map.neighbor_mask8(u) & graph.dirs; m; m &= m - 1) {
+        const int k = std::countr_zero(m);
+        const int v = u + graph.off[k];
+        if (ctx.closed(v)) continue;
+        const typename Rec::Cost cv = Rec::step(cu, k);
+        const double ng = Rec::value(cv);
+        if (ng < ctx.g(v)) {
+          ctx.set(v, cv, (unsigned)k);
+          open.push(v, ng + h(v));   // lazy decrease-key
+        }
+      }
+    }
+
+    auto t1 = std::chrono::steady_clock::now();
+    r.stats.millis    = std::chrono::duration<double,std::milli>(t1-t0).count();
+    r.stats.expanded  = expanded;
+    r.stats.pushes    = open.push_count();
+    r.stats.pops      = open.pop_count();
+    r.stats.peak_open = open.peak_size();
+
+    if (!ctx.seen(gId)) return r;
+    r.found = true;
+
+    // 경로 복원: 방향 코드를 거꾸로 따라감 (출발점의 방향 코드는 쓰지 않음)
+    std::vector<int> moves;
+    for (int v = gId; v != sId; ) {
+      const unsigned k = ctx.dir(v);
+      moves.push_back((int)k);
+      v -= graph.off[k];
+    }
+    r.path.reserve(moves.size() + 1);
+    int v = sId;
+    r.path.push_back(map.from_padded(v));
+    for (auto it = moves.rbegin(); it != moves.rend(); ++it) {
+      v += graph.off[*it];
+      r.cost += GridGraph::WC[*it];
+      r.path.push_back(map.from_padded(v));
+    }
+    return r;
+  }
+
+private:
+  BestFirstSearch<Queue, DynamicHeuristic> fallback_;
+  SearchContext fallback_ctx_;
+  Queue open_;
+};
+
+template <class Queue = BinaryHeap<int,double>>
+using FloatGSearchT = PackedGridSearchT<Queue, FloatNodeRecord>;
+template <class Queue = BinaryHeap<int,double>>
+using StepCountSearchT = PackedGridSearchT<Queue, StepCountNodeRecord>;
+
+} // namespace pathlab
@@ -0,0 +1,102 @@
+#pragma once
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+namespace pathlab {
+
+// 노드당 8바이트 패킹 레코드 (SearchContext의 double g + int parent + uint32 stamp = 16바이트 대비 절반)
+// - parent ID 대신 부모 → 노드 이동 방향 코드(DIR_DX/DIR_DY 순서, 4비트)를 두고 경로는 방향을 거꾸로 따라 복원.
+// - 세대 스탬프(closed = epoch+1)도 같은 워드에 넣어 relax 한 번이 캐시 라인 하나만 건드린다.
+// - Rec::Cost는 탐색 중 g 표현, step(c, k)는 방향 k 이동 후 비용, value(c)는 비교·큐 키용 double.
+// - Rec::kMaxMoves: 한 방향 종류(직교/대각)로 셀 수 있는 최대 이동 수. 최단 경로는 칸을 두 번 지나지
+//   않으므로 칸 수(W*H)가 이 값 이하인 맵에서만 안전하다 (PackedGridSearchT가 검사).
+
+// float g: 24비트 가수라 긴 경로에서는 반올림이 쌓여 거의 같은 두 경로 중 하나를 잘못 고를 수 있다.
+// 보고 비용은 복원한 경로를 따라 double로 다시 더한다.
+struct FloatNodeRecord {
+  using Cost = float;
+  static constexpr unsigned kStampBits = 28;
+  static constexpr uint64_t kMaxMoves  = ~uint64_t{0};   // 이동 수를 세지 않음
+
+  float    g;
+  uint32_t meta;          // [31:4] stamp, [3:0] dir
+
+  uint32_t stamp() const { return meta >> 4; }
+  unsigned dir()   const { return meta & 0xFu; }
+  Cost     cost()  const { return g; }
+  void set_stamp(uint32_t s)  { meta = (s << 4) | (meta & 0xFu); }
+  void set(Cost c, unsigned d) { g = c; meta = (meta & ~0xFu) | d; }
+
+  static Cost   zero() { return 0.0f; }
+  static Cost   step(Cost c, int k) { return c + (k < 4 ? 1.0f : 1.41421356f); }
+  static double value(Cost c) { return c; }
+};
+
+// 정수 g: 직교 이동 수 a, 대각 이동 수 b (g = a + b√2). 누적 오차가 없어 비교가 정확하다.
+// 각 24비트라 방향별 2^24-1(약 1677만) 이동까지. 8k×8k(6700만 칸)의 뱀 모양 미로는 최단 경로가
+// 이를 넘을 수 있으므로 칸 수가 kMaxMoves를 넘는 맵은 탐색기가 double g 엔진으로 넘긴다.
+struct StepCountNodeRecord {
+  struct Cost { uint32_t straight, diag; };
+  static constexpr unsigned kStampBits = 12;
+  static constexpr uint64_t kMaxMoves  = (1u << 24) - 1;
+
+  uint64_t bits;          // [63:40] straight, [39:16] diag, [15:4] stamp, [3:0] dir
+
+  uint32_t stamp() const { return (uint32_t)(bits >> 4) & 0xFFFu; }
+  unsigned dir()   const { return (unsigned)bits & 0xFu; }
+  Cost     cost()  const { return { (uint32_t)(bits >> 40), (uint32_t)(bits >> 16) & 0xFFFFFFu }; }
+  void set_stamp(uint32_t s) { bits = (bits & ~(uint64_t)0xFFF0u) | ((uint64_t)s << 4); }
+  void set(Cost c, unsigned d) {
+    bits = ((uint64_t)c.straight << 40) | ((uint64_t)c.diag << 16) | (bits & 0xFFF0u) | d;
+  }
+
+  static Cost   zero() { return { 0, 0 }; }
+  static Cost   step(Cost c, int k) { k < 4 ? ++c.straight : ++c.diag; return c; }
+  static double value(Cost c) { return c.straight + c.diag * 1.41421356237309504880; }
+};
+
+// 쿼리 간 재사용하는 패킹 작업공간 (SearchContext와 같은 세대 스탬프 규칙, 스탬프 폭만 레코드별)
+// - 스탬프가 한 바퀴 돌면 전체 초기화 (StepCount는 약 2000쿼리마다).
+template <class Rec>
+class PackedSearchContext {
+public:
+  using Record = Rec;
+  using Cost   = typename Rec::Cost;
+  static constexpr double   INF       = std::numeric_limits<double>::infinity();
+  static constexpr uint32_t kMaxStamp = (1u << Rec::kStampBits) - 1;
+
+  void begin(size_t n) {
+    if (rec_.size() < n) rec_.resize(n, Rec{});
+    if (epoch_ + 3 > kMaxStamp) {
+      std::fill(rec_.begin(), rec_.end(), Rec{});
+      epoch_ = 0;
+    }
+    epoch_ += 2;
+  }
+
+  bool     seen(int v)   const { return rec_[v].stamp() >= epoch_; }
+  bool     closed(int v) const { return rec_[v].stamp() == epoch_ + 1; }
+  double   g(int v)      const { return seen(v) ? Rec::value(rec_[v].cost()) : INF; }
+  Cost     cost(int v)   const { return rec_[v].cost(); }       // seen(v)일 때만 의미 있음
+  unsigned dir(int v)    const { return rec_[v].dir(); }
+
+  // g/방향 갱신 (closed 표시는 유지)
+  void set(int v, Cost c, unsigned d) {
+    Rec& r = rec_[v];
+    r.set(c, d);
+    if (r.stamp() < epoch_) r.set_stamp(epoch_);
+  }
+  void close(int v) { rec_[v].set_stamp(epoch_ + 1); }
+
+  size_t capacity() const { return rec_.size(); }
+  static constexpr size_t bytes_per_node() { return sizeof(Rec); }
+
+private:
+  std::vector<Rec> rec_;
+  uint32_t epoch_{0};
+};
+
+} // namespace pathlab
@@ -0,0 +1,55 @@
+#pragma once
+#include <vector>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+namespace pathlab {
+
+// 쿼리 간 재사용하는 탐색 작업공간 (g/dist, parent, closed)
+// - 노드별 세대 스탬프(epoch)로 O(1) 리셋: stamp < epoch 이면 이번 쿼리에서 미방문.
+// - stamp == epoch 은 방문(open), epoch+1 은 closed. 세대는 쿼리마다 2씩 증가.
+// - 배열 재할당/전체 초기화는 노드 수가 늘거나 스탬프가 한 바퀴 돌 때만 발생.
+// - 스레드당 하나씩 두고 시나리오 파일 전체에서 재사용한다.
+class SearchContext {
+public:
+  static constexpr double INF = std::numeric_limits<double>::infinity();
+
+  // 새 쿼리 시작: 최소 n개 노드 확보 후 세대 증가
+  void begin(size_t n) {
+    if (g_.size() < n) {
+      g_.resize(n);
+      parent_.resize(n);
+      stamp_.resize(n, 0);
+    }
+    if (epoch_ >= std::numeric_limits<uint32_t>::max() - 3) {
+      std::fill(stamp_.begin(), stamp_.end(), 0u);
+      epoch_ = 0;
+    }
+    epoch_ += 2;
+  }
+
+  bool   seen(int v)   const { return stamp_[v] >= epoch_; }
+  bool   closed(int v) const { return stamp_[v] == epoch_ + 1; }
+  double g(int v)      const { return seen(v) ? g_[v] : INF; }
+  int    parent(int v) const { return seen(v) ? parent_[v] : -1; }
+
+  // g/parent 갱신 (closed 표시는 유지)
+  void set(int v, double g, int parent) {
+    g_[v] = g;
+    parent_[v] = parent;
+    if (stamp_[v] < epoch_) stamp_[v] = epoch_;
+  }
+  void close(int v) { stamp_[v] = epoch_ + 1; }
+
+  size_t capacity() const { return g_.size(); }
+
+private:
+  std::vector<double>   g_;
+  std::vector<int>      parent_;
+  std::vector<uint32_t> stamp_;
+  uint32_t epoch_{0};
+};
+
+} // namespace pathlab
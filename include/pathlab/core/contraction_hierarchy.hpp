@@ -0,0 +1,63 @@
+// include/pathlab/core/contraction_hierarchy.hpp
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+#include "pathlab/core/csr_graph.hpp"
+
+namespace pathlab {
+
+// Contraction Hierarchies (대칭 그래프 전용, 예: CsrGraph::from_grid)
+// - 순서: edge difference (추가될 shortcut 수 - 차수) + 이미 축약된 이웃 수.
+//   매 라운드 우선순위가 1-hop 이웃보다 작은 노드(독립 집합)를 ThreadPool로 동시에 축약한다.
+//   witness 탐색은 이번 라운드에 축약되는 노드를 모두 건너뛰므로 동시 축약이어도 거리가 보존된다.
+// - witness 탐색: 남은 그래프에서 제한된 Dijkstra (확정 kWitnessSettle개 또는 필요한 최대 거리까지).
+//   못 찾으면 shortcut을 넣으므로 제한은 정확도가 아니라 shortcut 수에만 영향.
+// - 결과: 노드별 상향 간선(자신보다 늦게 축약된 이웃) CSR. shortcut은 가운데 노드 mid를 기억.
+// - 맵 파일 옆(<map>.ch)에 저장 (그래프 fingerprint로 검증).
+class ContractionHierarchy {
+public:
+    static constexpr uint32_t kNoMid = std::numeric_limits<uint32_t>::max();
+    static constexpr int kWitnessSettle = 500;
+
+    struct Arc {
+        uint32_t to;
+        uint32_t mid;   // 원래 간선이면 kNoMid
+        double   w;
+    };
+
+    ContractionHierarchy() = default;
+
+    void build(const CsrGraph& g, unsigned threads = 1);
+    bool save(const std::string& filepath) const;
+    bool load(const std::string& filepath, const CsrGraph& g);
+
+    // 저장본이 맞으면 읽고, 없거나 다르면 새로 만들어 저장. 반환: 읽었으면 true
+    bool load_or_build(const std::string& map_path, const CsrGraph& g, unsigned threads = 1);
+    static std::string default_path(const std::string& map_path) { return map_path + ".ch"; }
+
+    bool empty() const { return up_off_.empty(); }
+    uint32_t node_count() const { return (uint32_t)rank_.size(); }
+    size_t arc_count() const { return up_.size(); }
+    size_t shortcut_count() const { return shortcuts_; }
+    uint32_t rank(uint32_t v) const { return rank_[v]; }
+
+    const Arc* up_begin(uint32_t v) const { return up_.data() + up_off_[v]; }
+    const Arc* up_end(uint32_t v)   const { return up_.data() + up_off_[v + 1]; }
+
+    // 상향 간선 하나(u–v, 가운데 mid)를 원래 간선 열로 펼쳐 u 다음부터 v까지 out에 붙인다.
+    // cost에는 원래 간선 가중치를 경로 순서대로 더한다 (격자 탐색의 g 누적과 같은 순서).
+    void unpack(uint32_t u, uint32_t v, uint32_t mid, std::vector<uint32_t>& out, double& cost) const;
+
+private:
+    const Arc* find_up(uint32_t lo, uint32_t hi) const;
+
+    uint64_t fingerprint_{0};
+    size_t shortcuts_{0};
+    std::vector<uint32_t> rank_;   // 노드 → 축약 순서
+    std::vector<uint64_t> up_off_; // 노드 수 + 1
+    std::vector<Arc>      up_;
+};
+
+} // namespace pathlab
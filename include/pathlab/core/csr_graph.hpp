@@ -0,0 +1,79 @@
+// include/pathlab/core/csr_graph.hpp
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "pathlab/core/grid_map.hpp"
+
+namespace pathlab {
+
+// 격자 → CSR 변환 시 free 칸 번호 순서 (탐색 배열 g/parent/stamp의 메모리 배치)
+// - RowMajor: y*W+x 순 (위/아래 이웃은 W칸 떨어짐)
+// - Morton:   Z-order (x, y 비트 교차)
+// - Hilbert:  Hilbert 곡선 (2^k 정사각형 위, 곡선상 인접 = 격자 인접)
+enum class GridLayout { RowMajor, Morton, Hilbert };
+
+// 명시적 방향 그래프 (CSR): 노드 v의 간선 [offsets[v], offsets[v+1]) → (targets[e], weights[e]).
+// - ID는 32비트, 가중치는 double (격자 변환 시 직교=1, 대각=√2).
+// - load_dimacs: DIMACS 9th challenge .gr ("p sp n m", "a u v w", 1-based ID) → 0-based 노드.
+//   간선은 출발 노드별로 파일 순서를 유지한다. 방향 그래프 그대로 (도로망은 보통 양방향 간선이 모두 있다).
+//   가중치는 0 이상이면 받는다 (0 가중치 간선·사이클 포함, 예: data/graphs/zero_weight.gr).
+// - from_grid: free 칸을 행 우선 순서로 노드 번호를 매기고, 이웃 마스크(corner-cutting 금지 포함)대로
+//   간선을 만든다. 양방향 간선이 모두 들어가므로 대칭 그래프. 노드 ↔ 격자 칸 대응도 함께 보관.
+//   layout으로 번호 순서(공간 채움 곡선)를 고르면 노드별 배열이 그 순서로 놓인다.
+//   경로는 노드 ID이고 grid_id로 y*W+x로 되돌린다.
+class CsrGraph {
+public:
+    CsrGraph() = default;
+
+    static CsrGraph from_grid(const GridMap& map, bool allow_diagonal,
+                              GridLayout layout = GridLayout::RowMajor);
+    bool load_dimacs(const std::string& filepath);
+
+    uint32_t node_count() const { return offsets_.empty() ? 0u : (uint32_t)(offsets_.size() - 1); }
+    uint64_t edge_count() const { return targets_.size(); }
+
+    uint64_t edges_begin(uint32_t v) const { return offsets_[v]; }
+    uint64_t edges_end(uint32_t v)   const { return offsets_[v + 1]; }
+    uint32_t target(uint64_t e) const { return targets_[e]; }
+    double   weight(uint64_t e) const { return weights_[e]; }
+
+    // SearchGraph (core/graph.hpp)
+    template <class F>
+    void for_each_out(int u, F&& f) const {
+        for (uint64_t e = offsets_[(size_t)u], end = offsets_[(size_t)u + 1]; e < end; ++e)
+            f((int)targets_[e], weights_[e]);
+    }
+
+    const std::vector<uint64_t>& offsets() const { return offsets_; }
+    const std::vector<uint32_t>& targets() const { return targets_; }
+    const std::vector<double>&   weights() const { return weights_; }
+
+    // 격자에서 변환한 그래프: 노드 ↔ 칸(y*W+x). 아니면 grid_width()==0.
+    bool is_grid() const { return grid_w_ > 0; }
+    bool allow_diagonal() const { return diag_; }
+    int  grid_width()  const { return grid_w_; }
+    int  grid_height() const { return grid_h_; }
+    int32_t grid_id(uint32_t v) const { return grid_id_[v]; }
+    int32_t node_at(int x, int y) const {           // 범위 밖/장애물이면 -1
+        if (x < 0 || y < 0 || x >= grid_w_ || y >= grid_h_) return -1;
+        return node_of_[(size_t)y * grid_w_ + x];
+    }
+
+    // 노드당 bytes_per_node 배열에서 간선 양 끝이 다른 64바이트 라인에 놓이는 비율 (배치 지역성 지표)
+    double cross_line_fraction(size_t bytes_per_node = sizeof(double)) const;
+
+    // 구조+가중치 FNV-1a 해시 (전처리 파일이 같은 그래프인지 검증)
+    uint64_t fingerprint() const;
+
+private:
+    std::vector<uint64_t> offsets_;
+    std::vector<uint32_t> targets_;
+    std::vector<double>   weights_;
+    int  grid_w_{0}, grid_h_{0};
+    bool diag_{false};
+    std::vector<int32_t> grid_id_; // 노드 → y*W+x
+    std::vector<int32_t> node_of_; // y*W+x → 노드 (-1)
+};
+
+} // namespace pathlab
@@ -0,0 +1,56 @@
+// include/pathlab/core/first_move_table.hpp
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/algorithms/ipathfinder.hpp"
+
+namespace pathlab {
+
+// CPD(compressed path database): 출발 칸마다 모든 목표 칸으로의 최적 첫 이동.
+// - 빌드: free 칸마다 Dijkstra 전체 스윕 (DijkstraT::sweep, 직교=1/대각=√2, corner-cutting 금지)
+//   후 최단 경로 트리에서 첫 이동을 전파. 출발 칸 단위로 ThreadPool 병렬.
+// - 압축: 목표 칸을 free 칸 순서(행 우선)로 늘어놓고 같은 이동이 이어지는 구간을 run으로 저장.
+//   run 하나 = uint32 (시작 순번 << 4 | 이동). 출발 칸 자신은 wildcard(앞 run에 흡수).
+//   이동 코드 0..7 = DIR_DX/DIR_DY 방향, 8 = 도달 불가.
+// - 질의: run 이진 탐색으로 첫 이동 → 목표까지 반복 (탐색 없음, O(경로 길이 · log runs)).
+// - 맵 파일 옆(<map>.cpd)에 저장 (크기/점유 해시/이동 규칙, 로드 시 run 구조까지 검증).
+class FirstMoveTable {
+public:
+    static constexpr int kNone = 8;
+
+    FirstMoveTable() = default;
+
+    void build(const GridMap& map, bool allow_diagonal, unsigned threads = 1);
+    bool save(const std::string& filepath) const;
+    bool load(const std::string& filepath, const GridMap& map, bool allow_diagonal);
+
+    // 저장본이 맞으면 읽고, 없거나 다르면 새로 만들어 저장. 반환: 읽었으면 true
+    bool load_or_build(const std::string& map_path, const GridMap& map, bool allow_diagonal, unsigned threads = 1);
+    static std::string default_path(const std::string& map_path) { return map_path + ".cpd"; }
+
+    bool empty() const { return row_off_.empty(); }
+    bool allow_diagonal() const { return diag_; }
+    size_t run_count() const { return runs_.size(); }
+    size_t bytes() const { return runs_.size() * sizeof(uint32_t) + row_off_.size() * sizeof(uint64_t)
+                                + rank_.size() * sizeof(int32_t); }
+
+    // (sx,sy)에서 (gx,gy)로 가는 최적 첫 이동 방향 k (같은 칸/도달 불가/장애물이면 -1)
+    int first_move(int sx, int sy, int gx, int gy) const;
+
+    // 첫 이동을 따라 경로 추출 (PathResult: 노드ID y*W+x, cost, stats.millis)
+    PathResult path(int sx, int sy, int gx, int gy) const;
+
+private:
+    int move_from(int src_rank, int dst_rank) const;
+
+    int width_{0}, height_{0};
+    bool diag_{true};
+    uint64_t hash_{0};
+    std::vector<int32_t>  rank_;    // 칸(y*W+x) → free 순번 (장애물 -1)
+    std::vector<uint64_t> row_off_; // free 순번 s의 run 구간 [row_off_[s], row_off_[s+1])
+    std::vector<uint32_t> runs_;
+};
+
+} // namespace pathlab
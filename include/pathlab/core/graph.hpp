@@ -0,0 +1,53 @@
+// include/pathlab/core/graph.hpp
+#pragma once
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include "pathlab/core/grid_map.hpp"
+
+namespace pathlab {
+
+// 탐색 엔진(BestFirstSearch의 Dijkstra 계열, dmm::BMSSP)이 요구하는 그래프 인터페이스
+// - node_count(): 노드 ID 범위 [0, n) (작업공간 크기)
+// - for_each_out(u, f): u의 나가는 간선마다 f(v, w), w ≥ 0
+template <class G>
+concept SearchGraph = requires(const G& g, int u) {
+    { g.node_count() } -> std::convertible_to<size_t>;
+    g.for_each_out(u, [](int, double) {});
+};
+
+// GridMap을 SearchGraph로 보는 얇은 뷰: 노드 = 패딩 칸 ID, 간선 = 이웃 마스크 & dirs
+// (직교=1, 대각=√2, corner-cutting 금지는 마스크에 반영되어 있음). 범위 검사 없음.
+struct GridGraph {
+    static constexpr double SQRT2 = 1.41421356237309504880;
+    static constexpr double WC[8] = { 1.0, 1.0, 1.0, 1.0, SQRT2, SQRT2, SQRT2, SQRT2 };
+
+    const GridMap* map{nullptr};
+    unsigned dirs{0xFFu};
+    int off[8]{};
+
+    GridGraph() = default;
+    GridGraph(const GridMap& m, unsigned dir_bits) : map(&m), dirs(dir_bits) {
+        for (int k = 0; k < 8; ++k) off[k] = DIR_DX[k] + DIR_DY[k] * m.padded_width();
+    }
+    GridGraph(const GridMap& m, bool allow_diagonal) : GridGraph(m, allow_diagonal ? 0xFFu : 0x0Fu) {}
+
+    size_t node_count() const { return (size_t)map->padded_size(); }
+
+    // 이동 방향까지 필요한 격자 전용 루프 (양방향 포텐셜 등): f(k, v, w), k는 DIR_DX/DIR_DY 순서
+    template <class F>
+    void for_each_move(int u, F&& f) const {
+        for (unsigned m = map->neighbor_mask8(u) & dirs; m; m &= m - 1) {
+            const int k = std::countr_zero(m);
+            f(k, u + off[k], WC[k]);
+        }
+    }
+
+    template <class F>
+    void for_each_out(int u, F&& f) const {
+        for_each_move(u, [&](int, int v, double w) { f(v, w); });
+    }
+};
+
+} // namespace pathlab
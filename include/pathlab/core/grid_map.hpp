@@ -1,26 +1,103 @@
 // include/pathlab/core/grid_map.hpp
 #pragma once
+#include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
 namespace pathlab {
 
+class MappedFile;
+
 struct Coord {
     int x, y;
 };
 
+// 이동 방향 순서 (k<4 직교, k>=4 대각). 이웃 마스크의 비트 k와 1:1 대응.
+inline constexpr int DIR_DX[8] = { 1,-1, 0, 0, 1, 1,-1,-1 };
+inline constexpr int DIR_DY[8] = { 0, 0, 1,-1, 1,-1, 1,-1 };
+
+// 점유 격자: 로드 시 테두리 1칸(장애물)을 덧댄 row-major 바이트 배열로 압축.
+// - 외부 노드ID는 y*W + x, 탐색 내부 ID는 패딩 좌표 (y+1)*(W+2) + (x+1).
+// - 패딩 덕분에 이웃 ID = u + offset 이고, 범위 검사 없이 is_free_fast로 판정 가능.
+// - 셀마다 유효 이동(corner-cutting 금지 포함)을 8비트 마스크로 미리 계산해 둔다.
+// - 행/열 단위 64비트 비트보드(free=1)도 함께 만들어 직선 스캔을 ctz/clz로 처리한다.
+//
+// 파일 형식 (load_from_file이 첫 4바이트로 판별)
+// - ASCII MovingAI .map: 헤더의 height/width를 따른다 (짧은 행/빠진 행은 장애물).
+// - 바이너리(.pmap, save_binary로 생성): 40바이트 헤더 + 패딩 행 비트보드 + (선택) 이웃 마스크.
+//   mmap으로 열어 행 비트보드와 이웃 마스크는 매핑을 그대로 가리키고(zero-copy),
+//   바이트 점유 배열과 열 비트보드만 비트에서 복원한다. 매핑은 GridMap 복사본끼리 공유.
+//   검증은 헤더/크기, 헤더의 본문 체크섬, 테두리 비트까지 (마스크를 다시 계산하지 않는다).
 class GridMap {
 public:
     GridMap() = default;
+    GridMap(const GridMap& o) { *this = o; }
+    GridMap& operator=(const GridMap& o);
+    GridMap(GridMap&&) noexcept = default;            // vector 이동은 버퍼 주소 유지
+    GridMap& operator=(GridMap&&) noexcept = default;
+
     bool load_from_file(const std::string& filepath);
+    // 바이너리 저장 (with_masks=false면 이웃 마스크는 로드 시 계산)
+    bool save_binary(const std::string& filepath, bool with_masks = true) const;
+    static std::string default_binary_path(const std::string& map_path) { return map_path + ".pmap"; }
+    bool is_mapped() const { return mapping_ != nullptr; } // 바이너리에서 zero-copy로 열렸는지
 
     bool is_free(int x, int y) const;
     int width() const { return width_; }
     int height() const { return height_; }
 
+    // --- 패딩 레이아웃 (범위 검사 없는 내부 접근) ---
+    int padded_width()  const { return width_ + 2; }
+    int padded_height() const { return height_ + 2; }
+    int padded_size()   const { return (width_ + 2) * (height_ + 2); }
+
+    int to_padded(int x, int y) const { return (y + 1) * (width_ + 2) + (x + 1); }
+    int padded_x(int p) const { return p % (width_ + 2) - 1; }
+    int padded_y(int p) const { return p / (width_ + 2) - 1; }
+    // 패딩 ID → 외부 노드ID (y*W + x)
+    int from_padded(int p) const { return padded_y(p) * width_ + padded_x(p); }
+
+    // 패딩 ID 기준, 범위 검사 없음 (테두리는 항상 장애물)
+    bool is_free_fast(int p) const { return occ_[p] != 0; }
+    const uint8_t* occupancy() const { return occ_.data(); }
+    // 패딩 점유 배열의 FNV-1a 해시 (전처리 테이블 파일이 같은 맵인지 검증)
+    uint64_t occupancy_hash() const;
+
+    // 후속 이동 마스크 (패딩 ID 기준). 비트 k = DIR_DX/DIR_DY[k] 방향 이동 가능.
+    // 8방은 대각 corner-cutting 규칙까지 반영, 4방은 직교 비트(하위 4비트)만.
+    uint8_t neighbor_mask8(int p) const { return nbr_[p]; }
+    uint8_t neighbor_mask4(int p) const { return nbr_[p] & 0x0F; }
+    uint8_t neighbor_mask(int p, bool allow_diagonal) const {
+        return allow_diagonal ? neighbor_mask8(p) : neighbor_mask4(p);
+    }
+    const uint8_t* neighbor_masks() const { return nbr_; }
+
+    // 비트보드 (패딩 좌표 기준, free=1). 행 py의 비트 px / 열 px의 비트 py.
+    int row_words() const { return (padded_width()  + 63) / 64; }
+    int col_words() const { return (padded_height() + 63) / 64; }
+    const uint64_t* row_bits(int py) const { return row_bits_ + (size_t)py * row_words(); }
+    const uint64_t* col_bits(int px) const { return col_bits_.data() + (size_t)px * col_words(); }
+
 private:
+    bool load_ascii(const char* data, size_t size);
+    bool load_binary(std::shared_ptr<const MappedFile> mf);
+    void reset();
+    void build_neighbor_masks();
+    void build_row_bits();
+    void build_col_bits();
+    void unpack_occupancy();
+
     int width_{0}, height_{0};
-    std::vector<std::string> grid_; // 원본 라인 저장 ('.', '@', 'T' 등)
+    std::vector<uint8_t> occ_; // 1 = free('.'), 0 = obstacle('@', 'T' 등)/테두리
+    // 셀별 8방 후속 마스크 (장애물/테두리는 0), 행 비트보드:
+    // 직접 계산했으면 *_store_를, 바이너리면 매핑을 가리킨다.
+    const uint8_t*  nbr_{nullptr};
+    const uint64_t* row_bits_{nullptr};
+    std::vector<uint8_t>  nbr_store_;
+    std::vector<uint64_t> row_store_;
+    std::vector<uint64_t> col_bits_; // 열(전치) 비트보드
+    std::shared_ptr<const MappedFile> mapping_;
 };
 
 } // namespace pathlab
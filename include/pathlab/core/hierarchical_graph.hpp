@@ -0,0 +1,84 @@
+// include/pathlab/core/hierarchical_graph.hpp
+#pragma once
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/algorithms/search_context.hpp"
+#include "pathlab/algorithms/dijkstra.hpp"
+
+namespace pathlab {
+
+// HPA* 추상 그래프: 맵을 C×C 클러스터로 나누고 클러스터 경계의 entrance 칸을 노드로 둔다.
+// - entrance: 이웃 클러스터와 맞닿은 경계에서 양쪽 칸이 모두 free인 최대 구간.
+//   구간 길이 < kWideEntrance면 가운데 한 쌍, 아니면 양 끝 두 쌍의 칸을 전이(transition)로 잡는다.
+// - inter 간선: 전이 쌍 (직교 이웃, 비용 1). intra 간선: 같은 클러스터 노드 사이의
+//   클러스터 안으로 제한한 최단 거리 (이웃 마스크 = 전체 탐색과 같은 이동 규칙).
+// - 노드는 (클러스터, 칸) 순으로 정렬, 간선은 CSR. 클러스터 단위 ThreadPool 병렬 빌드.
+// - 맵 파일 옆(<map>.hpa)에 저장 (크기/점유 해시/클러스터 크기/이동 규칙으로 검증).
+class HierarchicalGraph {
+public:
+    static constexpr int kWideEntrance = 6;
+
+    struct Edge {
+        int    to;
+        double w;
+    };
+
+    HierarchicalGraph() = default;
+
+    void build(const GridMap& map, int cluster_size, bool allow_diagonal, unsigned threads = 1);
+    bool save(const std::string& filepath) const;
+    bool load(const std::string& filepath, const GridMap& map, int cluster_size, bool allow_diagonal);
+
+    // 저장본이 맞으면 읽고, 없거나 다르면 새로 만들어 저장. 반환: 읽었으면 true
+    bool load_or_build(const std::string& map_path, const GridMap& map, int cluster_size,
+                       bool allow_diagonal, unsigned threads = 1);
+    static std::string default_path(const std::string& map_path) { return map_path + ".hpa"; }
+
+    bool empty() const { return cluster_begin_.empty(); }
+    bool allow_diagonal() const { return diag_; }
+    int  cluster_size() const { return csize_; }
+    int  cluster_count() const { return ccols_ * crows_; }
+    int  cluster_of(int x, int y) const { return (y / csize_) * ccols_ + x / csize_; }
+    size_t node_count() const { return node_cell_.size(); }
+    size_t edge_count() const { return edges_.size(); }
+
+    // 노드: 패딩 칸 ID, 클러스터 c의 노드 구간 [cluster_begin(c), cluster_begin(c+1))
+    int node_cell(int i) const { return node_cell_[i]; }
+    int node_cluster(int i) const { return node_cluster_[i]; }
+    int cluster_begin(int c) const { return cluster_begin_[c]; }
+    const Edge* edges_begin(int i) const { return edges_.data() + edge_off_[i]; }
+    const Edge* edges_end(int i)   const { return edges_.data() + edge_off_[i + 1]; }
+
+    // 클러스터 안 탐색 작업공간 (스레드/솔버당 하나, 호출 간 재사용)
+    struct LocalWorkspace {
+        SearchContext ctx;                // 결과 g/parent
+        Dijkstra engine;                  // 공통 최선 우선 루프 (큐 재사용)
+        std::vector<int> head, next;      // 목표 표시: 클러스터 안 칸 → 목표 인덱스 연결 목록
+    };
+
+    // 클러스터 c 안으로 제한한 Dijkstra: 패딩 칸 src에서 targets[0..n) 칸이 모두 확정되면 종료.
+    // dist[i] = 거리 (도달 불가 INF), 반환값 = 확장 수. 결과 트리는 ws.ctx의 parent.
+    uint64_t local_search(LocalWorkspace& ws, const GridMap& map, int src, int cluster,
+                          const int* targets, size_t n_targets, double* dist) const;
+
+    // 같은 클러스터의 두 칸 사이 최단 경로를 out에 이어 붙인다 (from 제외, 노드ID y*W+x).
+    // 반환: 거리 (도달 불가 INF, out 변경 없음)
+    double local_path(LocalWorkspace& ws, const GridMap& map, int from, int to, int cluster,
+                      std::vector<int>& out, uint64_t* expanded = nullptr) const;
+
+private:
+    int width_{0}, height_{0};
+    int csize_{16}, ccols_{0}, crows_{0};
+    bool diag_{true};
+    uint64_t hash_{0};
+    std::vector<int32_t>  node_cell_;
+    std::vector<int32_t>  node_cluster_;
+    std::vector<int32_t>  cluster_begin_; // 클러스터 수 + 1
+    std::vector<uint32_t> edge_off_;      // 노드 수 + 1
+    std::vector<Edge>     edges_;
+};
+
+} // namespace pathlab
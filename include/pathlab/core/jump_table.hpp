@@ -0,0 +1,42 @@
+// include/pathlab/core/jump_table.hpp
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "pathlab/core/grid_map.hpp"
+
+namespace pathlab {
+
+// JPS+ 전처리 테이블: 셀(패딩 ID)·방향(DIR_DX/DIR_DY 순서)별 다음 jump point까지 거리.
+// - d > 0 : 그 방향으로 d칸 가면 jump point
+// - d <= 0: jump point 없이 -d칸 진행 후 벽 (0 = 바로 막힘)
+// - 규칙은 JPS(corner-cutting 금지)와 동일, goal 처리는 쿼리 시점에 한다.
+// - 맵 파일 옆(<map>.jpsplus)에 저장해 두고 재사용 (크기/점유 해시로 검증).
+// - 거리는 int16이라 한 변이 kMaxSide를 넘는 맵은 만들지 않는다 (빈 테이블 → JPS가 비트보드 점프로 대체).
+class JumpTable {
+public:
+    static constexpr int kMaxSide = 32766;   // 직선 구간 길이 ≤ 한 변 < int16 최대값
+
+    JumpTable() = default;
+
+    static bool supports(const GridMap& map) { return map.width() <= kMaxSide && map.height() <= kMaxSide; }
+
+    // supports(map)이 아니면 테이블을 비워 둔다
+    void build(const GridMap& map);
+    bool save(const std::string& filepath) const;
+    bool load(const std::string& filepath, const GridMap& map);
+
+    // 저장본이 맞으면 읽고, 없거나 다르면 새로 만들어 저장. 반환: 읽었으면 true
+    bool load_or_build(const std::string& map_path, const GridMap& map);
+    static std::string default_path(const std::string& map_path) { return map_path + ".jpsplus"; }
+
+    bool empty() const { return dist_.empty(); }
+    int dist(int p, int k) const { return dist_[(size_t)p * 8 + k]; }
+
+private:
+    int width_{0}, height_{0};
+    uint64_t hash_{0};
+    std::vector<int16_t> dist_; // padded_size * 8
+};
+
+} // namespace pathlab
@@ -0,0 +1,79 @@
+// include/pathlab/core/landmark_table.hpp
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/util/heuristic_base.hpp"
+#include "pathlab/util/heuristic_manhattan.hpp"
+#include "pathlab/util/heuristic_octile.hpp"
+
+namespace pathlab {
+
+// ALT(랜드마크) 전처리 테이블: 랜드마크 L마다 모든 칸까지의 최단 거리 d_L.
+// - 하한: h(v,t) = max_L |d_L(v) - d_L(t)| (삼각 부등식, 일관 휴리스틱).
+// - 랜드마크 선택: farthest-point (첫 free 칸에서 가장 먼 칸, 이후 기존 랜드마크들과의 최소 거리가 최대인 칸).
+// - 저장: 칸(y*W+x) 우선 [cell][K] float, 도달 불가는 -1 (그 랜드마크는 건너뜀).
+//   float 반올림 오차로 하한이 참값을 넘지 않도록 eps(최대 거리 기준)를 빼고 0으로 자른다.
+// - 이동 규칙(8방/4방)은 테이블마다 고정, 맵 파일 옆(<map>.alt)에 저장 (크기/점유 해시/K/이동 규칙으로 검증).
+class LandmarkTable {
+public:
+    LandmarkTable() = default;
+
+    void build(const GridMap& map, int k, bool allow_diagonal);
+    bool save(const std::string& filepath) const;
+    bool load(const std::string& filepath, const GridMap& map, int k, bool allow_diagonal);
+
+    // 저장본이 맞으면 읽고, 없거나 다르면 새로 만들어 저장. 반환: 읽었으면 true
+    bool load_or_build(const std::string& map_path, const GridMap& map, int k, bool allow_diagonal);
+    static std::string default_path(const std::string& map_path) { return map_path + ".alt"; }
+
+    bool empty() const { return dist_.empty(); }
+    int  size() const { return k_; }                  // 랜드마크 수
+    bool allow_diagonal() const { return diag_; }
+    const std::vector<int>& landmarks() const { return lm_; } // 랜드마크 칸 (y*W+x)
+
+    // 랜드마크 하한 (비어 있거나 모든 랜드마크에서 도달 불가면 0)
+    double bound(int x1, int y1, int x2, int y2) const {
+        const float* a = dist_.data() + ((size_t)y1 * width_ + x1) * k_;
+        const float* b = dist_.data() + ((size_t)y2 * width_ + x2) * k_;
+        float best = 0.0f;
+        for (int i = 0; i < k_; ++i) {
+            if (a[i] < 0.0f || b[i] < 0.0f) continue;
+            best = std::max(best, std::fabs(a[i] - b[i]));
+        }
+        return std::max(0.0, (double)best - eps_);
+    }
+
+private:
+    int width_{0}, height_{0}, k_{0}, requested_{0};
+    bool diag_{true};
+    uint64_t hash_{0};
+    double eps_{0.0};
+    std::vector<int> lm_;
+    std::vector<float> dist_; // W*H*K
+};
+
+// ALT: max(랜드마크 하한, 기하 하한). 기하 하한은 테이블의 이동 규칙 (8방 옥타일 / 4방 맨해튼).
+// 둘 다 일관 휴리스틱이므로 max도 일관.
+inline double h_alt(const LandmarkTable& lt, int x1,int y1,int x2,int y2){
+    const double geo = lt.allow_diagonal() ? h_octile(x1,y1,x2,y2) : h_manhattan(x1,y1,x2,y2);
+    return std::max(geo, lt.bound(x1,y1,x2,y2));
+}
+
+struct AltH {
+    const LandmarkTable* lt;
+    double operator()(int x1,int y1,int x2,int y2) const { return h_alt(*lt, x1,y1,x2,y2); }
+};
+
+// 랜드마크 테이블 → ALT Heuristic (테이블은 Heuristic보다 오래 살아야 함)
+inline Heuristic make_alt_heuristic(const LandmarkTable& lt){
+    const LandmarkTable* p = &lt;
+    Heuristic H{ [p](int x1,int y1,int x2,int y2){ return h_alt(*p, x1,y1,x2,y2); }, "alt", HeuType::Alt };
+    H.landmarks = p;
+    return H;
+}
+
+} // namespace pathlab
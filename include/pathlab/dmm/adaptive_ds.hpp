@@ -3,6 +3,8 @@
 #include <vector>
 #include <utility>
 #include <limits>
+#include <cmath>
+#include <unordered_map>
 
 namespace pathlab::dmm {
 
@@ -12,9 +14,14 @@ struct VertexDistance {
   bool operator>(const VertexDistance& o) const { return d > o.d; }
 };
 
+// BMSSP의 D 구조 (Lemma 3.3 인터페이스) — 힙 기반 기준 구현
+// - 정점당 최소 거리 하나만 유효 (best 맵), 더 큰 중복 insert는 무시, 옛 항목은 pull 때 건너뜀.
+// - pull(): 가장 작은 정점 최대 capacity개 + 마지막 값과 같은 동률 전부,
+//   반환 경계 x는 (반환값 < x ≤ 남은 값) 을 만족 (남은 것이 없으면 bound).
 struct AdaptiveDataStructure {
   // min-heap by distance
   std::priority_queue<VertexDistance, std::vector<VertexDistance>, std::greater<VertexDistance>> pq;
+  std::unordered_map<size_t,double> best; // 정점 → 현재 유효 거리
   size_t capacity{0};
   double bound{std::numeric_limits<double>::infinity()};
 
@@ -24,29 +31,55 @@ struct AdaptiveDataStructure {
   void reset(size_t cap, double bnd) {
     capacity = cap; bound = bnd;
     pq = decltype(pq)();
+    best.clear();
   }
 
   void insert(size_t v, double d) {
-    if (d < bound && std::isfinite(d)) pq.push({v,d});
+    if (!(d < bound) || !std::isfinite(d)) return;
+    auto [it, fresh] = best.try_emplace(v, d);
+    if (!fresh) {
+      if (!(d < it->second)) return;
+      it->second = d;
+    }
+    pq.push({v,d});
   }
 
   void batch_prepend(std::vector<std::pair<size_t,double>> items) {
     for (auto& it : items) insert(it.first, it.second);
   }
 
-  // pull(): (min_remaining, vertices up to 'capacity')
+  // pull(): (min_remaining, vertices up to 'capacity' + ties)
   std::pair<double, std::vector<size_t>> pull() {
     std::vector<size_t> res; res.reserve(capacity);
-    for (size_t i=0; i<capacity && !pq.empty(); ++i) {
-      res.push_back(pq.top().v);
+    double last = -std::numeric_limits<double>::infinity();
+    for (;;) {
+      drop_stale();
+      if (pq.empty()) break;
+      const VertexDistance top = pq.top();
+      if (res.size() >= capacity && top.d != last) break;
       pq.pop();
+      best.erase(top.v);
+      res.push_back(top.v);
+      last = top.d;
     }
+    drop_stale();
     double min_remaining = bound;
     if (!pq.empty()) min_remaining = std::min(min_remaining, pq.top().d);
     return { min_remaining, std::move(res) };
   }
 
-  bool is_empty() const { return pq.empty(); }
+  bool is_empty() { drop_stale(); return pq.empty(); }
+  size_t size() const { return best.size(); }
+
+private:
+  // 더 작은 값으로 갱신됐거나 이미 pull된 정점의 항목 제거
+  void drop_stale() {
+    while (!pq.empty()) {
+      auto it = best.find(pq.top().v);
+      if (it != best.end() && it->second == pq.top().d) break;
+      pq.pop();
+    }
+  }
 };
 
 } // namespace pathlab::dmm
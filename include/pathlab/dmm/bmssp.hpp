@@ -0,0 +1,325 @@
+#pragma once
+#include <vector>
+#include <limits>
+#include <chrono>
+#include <cmath>
+#include <bit>
+#include <queue>
+#include <utility>
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#include "pathlab/algorithms/ipathfinder.hpp"
+#include "pathlab/algorithms/search_context.hpp"
+#include "pathlab/core/grid_map.hpp"
+#include "pathlab/core/graph.hpp"
+#include "pathlab/dmm/adaptive_ds.hpp"
+#include "pathlab/dmm/efficient_ds.hpp"
+
+namespace pathlab::dmm {
+
+// BMSSP (Duan et al., "Breaking the Sorting Barrier for Directed SSSP") 재귀 엔진
+// - k = ⌊log^{1/3} n⌋, t = ⌊log^{2/3} n⌋, 최상위 레벨 L = ⌈log n / t⌉, 호출 BMSSP(L, ∞, {s}).
+// - BMSSP(l, B, S): FindPivots로 S를 피벗 P로 줄이고, D(용량 2^{(l-1)t}, 상한 B)에서
+//   pull한 (B_i, S_i)로 BMSSP(l-1, B_i, S_i)를 재귀 호출, 완료 집합 U_i의 간선을 완화해
+//   [B_i,B)는 D.insert, [B'_i,B_i)는 batch_prepend. |U| ≥ k·2^{lt}면 부분 실행으로 종료.
+// - l = 0은 BaseCase: S에서 k+1개까지 Dijkstra.
+// - 완화는 논문대로 "≤" (동률 경로가 많은 격자에서 정점이 올바른 하위 문제로 가도록).
+//   단 pred는 "<"일 때만 바꾼다. 0 가중치 간선의 동률에서 pred를 덮어쓰면 pred 사이클이 생긴다.
+// - 단일 쌍 쿼리: goal이 어떤 호출의 완료 집합 U에 들어가면 d̂[goal]이 확정이므로 즉시 되감는다.
+// - DS: reset(cap,B) / insert / batch_prepend / pull / is_empty, pull은 (반환값 < 경계 ≤ 남은 값)을
+//   지켜야 한다. 기본은 Lemma 3.3 블록 구조(EfficientDataStructure), 힙 기준 구현은 AdaptiveDataStructure.
+// - 그래프 G: SearchGraph (core/graph.hpp). 격자는 GridGraph 뷰(패딩 ID)로, CsrGraph 등은 노드 ID로 푼다.
+// - stats: expanded = 간선 완화를 위해 정점을 훑은 횟수(FindPivots/BaseCase/상위 완화 합),
+//          pushes = D insert+prepend 항목 수, pops = D에서 pull된 정점 수, peak_open = 미사용(0).
+template <class DS = EfficientDataStructure, SearchGraph G = pathlab::GridGraph>
+class BMSSP {
+public:
+  struct Params {
+    int k = 0;   // 0 = 자동 (⌊log^{1/3} n⌋)
+    int t = 0;   // 0 = 자동 (⌊log^{2/3} n⌋)
+  };
+
+  BMSSP() : P() {}
+  explicit BMSSP(const Params& p) : P(p) {}
+
+  pathlab::PathResult solve(const pathlab::GridMap& map,
+                            int sx, int sy, int gx, int gy,
+                            bool allow_diagonal = true)
+    requires std::is_same_v<G, pathlab::GridGraph> {
+    pathlab::SearchContext ctx;
+    return solve(ctx, map, sx, sy, gx, gy, allow_diagonal);
+  }
+
+  // ctx를 쿼리 간 재사용 (d̂ = ctx.g, pred = ctx.parent)
+  pathlab::PathResult solve(pathlab::SearchContext& ctx, const pathlab::GridMap& map,
+                            int sx, int sy, int gx, int gy,
+                            bool allow_diagonal = true)
+    requires std::is_same_v<G, pathlab::GridGraph> {
+    const int W = map.width(), H = map.height();
+    if (W<=0 || H<=0) return {};
+    if (sx<0||sy<0||gx<0||gy<0||sx>=W||gx>=W||sy>=H||gy>=H) return {};
+    if (!map.is_free(sx,sy) || !map.is_free(gx,gy)) return {};
+
+    // 내부 탐색은 패딩 ID 공간, 파라미터 n은 격자 칸 수
+    grid_ = pathlab::GridGraph(map, allow_diagonal);
+    pathlab::PathResult r = run(ctx, grid_, map.to_padded(sx,sy), map.to_padded(gx,gy), (double)W * H);
+    for (int& v : r.path) v = map.from_padded(v);
+    return r;
+  }
+
+  // 일반 그래프: 노드 s → t (path도 노드 ID)
+  pathlab::PathResult solve(pathlab::SearchContext& ctx, const G& graph, int s, int t) {
+    const int n = (int)graph.node_count();
+    if (s<0||t<0||s>=n||t>=n) return {};
+    return run(ctx, graph, s, t, (double)n);
+  }
+
+private:
+  using Result = std::pair<double, std::vector<int>>; // (B', U)
+
+  pathlab::PathResult run(pathlab::SearchContext& ctx, const G& graph, int sId, int gId, double n) {
+    PathResult r;
+    const size_t N = graph.node_count();
+    gId_ = gId;
+    const double INF = std::numeric_limits<double>::infinity();
+
+    ctx.begin(N);
+    ctx_ = &ctx;
+    graph_ = &graph;
+    prepare_scratch(N);
+
+    // 파라미터
+    const double lg = std::max(1.0, std::log2(n));
+    k_ = P.k > 0 ? P.k : std::max(1, (int)std::floor(std::cbrt(lg)));
+    t_ = P.t > 0 ? P.t : std::max(1, (int)std::floor(std::pow(lg, 2.0/3.0)));
+    const int L = std::max(1, (int)std::ceil(lg / t_));
+    if ((size_t)L + 1 > in_u_.size()) in_u_.resize((size_t)L + 1);
+    for (auto& a : in_u_) if (a.size() < N) a.resize(N, 0);
+
+    goal_done_ = false;
+    scans_ = pushes_ = pulls_ = 0;
+
+    auto t0 = std::chrono::steady_clock::now();
+
+    ctx.set(sId, 0.0, -1);
+    if (sId == gId_) goal_done_ = true;
+    else bmssp(L, INF, { sId });
+
+    auto t1 = std::chrono::steady_clock::now();
+    r.stats.millis   = std::chrono::duration<double,std::milli>(t1-t0).count();
+    r.stats.expanded = scans_;
+    r.stats.pushes   = pushes_;
+    r.stats.pops     = pulls_;
+
+    if (ctx.g(gId_) == INF) { r.found=false; return r; }
+    r.found = true;
+    r.cost  = ctx.g(gId_);
+
+    // pred 사슬은 최대 N개 — 넘으면 pred가 깨진 것이므로 경로 없음으로 보고
+    std::vector<int> rev;
+    for (int v=gId_; v!=-1; v=ctx.parent(v)) {
+      if (rev.size() >= N) { r.found=false; r.cost=0; return r; }
+      rev.push_back(v);
+    }
+    r.path.assign(rev.rbegin(), rev.rend());
+    return r;
+  }
+
+  double g(int v) const { return ctx_->g(v); }
+
+  // u의 간선 (v, w)마다 f 호출
+  template <class F>
+  void for_each_edge(int u, F&& f) {
+    ++scans_;
+    graph_->for_each_out(u, f);
+  }
+
+  // 스크래치 스탬프: 호출마다 새 값, 한 바퀴 돌면 배열 전체 초기화
+  uint32_t next_stamp() {
+    if (++stamp_ == 0) {
+      for (auto* a : { &wmark_, &smark_, &lmark_, &rstamp_, &bmark_ }) std::fill(a->begin(), a->end(), 0u);
+      for (auto& a : in_u_) std::fill(a.begin(), a.end(), 0u);
+      stamp_ = 1;
+    }
+    return stamp_;
+  }
+
+  void prepare_scratch(size_t n) {
+    if (wmark_.size() >= n) return;
+    for (auto* a : { &wmark_, &smark_, &lmark_, &rstamp_, &bmark_ }) a->resize(n, 0u);
+    root_.resize(n);
+    cnt_.resize(n);
+  }
+
+  // FindPivots(B, S): k 라운드 bounded Bellman-Ford → (P, W)
+  std::pair<std::vector<int>, std::vector<int>> find_pivots(double B, const std::vector<int>& S) {
+    const uint32_t st = next_stamp();
+    std::vector<int> Wset = S, frontier = S, next;
+    for (int x : S) { wmark_[x] = st; smark_[x] = st; }
+
+    for (int i = 1; i <= k_; ++i) {
+      const uint32_t ls = next_stamp();
+      next.clear();
+      for (int u : frontier) {
+        const double gu = g(u);
+        for_each_edge(u, [&](int v, double w) {
+          const double nd = gu + w;
+          if (nd <= g(v)) {
+            if (nd < g(v)) ctx_->set(v, nd, u);
+            if (nd < B) {
+              if (lmark_[v] != ls) { lmark_[v] = ls; next.push_back(v); }
+              if (wmark_[v] != st) { wmark_[v] = st; Wset.push_back(v); }
+            }
+          }
+        });
+      }
+      if (Wset.size() > (size_t)k_ * S.size()) return { S, std::move(Wset) };
+      frontier.swap(next);
+    }
+
+    // W 안의 pred 포레스트에서 S 뿌리별 트리 크기 → k 이상이면 피벗
+    for (int x : S) cnt_[x] = 0;
+    std::vector<int> path;
+    for (int v : Wset) {
+      int c = v, root = -1;
+      path.clear();
+      for (;;) {
+        if (smark_[c] == st)  { root = c; break; }
+        if (rstamp_[c] == st) { root = root_[c]; break; }
+        const int p = ctx_->parent(c);
+        if (p == -1 || wmark_[p] != st) break;
+        path.push_back(c);
+        c = p;
+      }
+      for (int q : path) { rstamp_[q] = st; root_[q] = root; }
+      if (root != -1) ++cnt_[root];
+    }
+    std::vector<int> Pv;
+    for (int x : S) if (cnt_[x] >= k_) Pv.push_back(x);
+    return { std::move(Pv), std::move(Wset) };
+  }
+
+  // BaseCase(B, S): S에서 출발해 B 미만으로 k+1개까지 확정하는 Dijkstra
+  // - 논문은 거리가 모두 다르다고 가정하고 U0의 최댓값을 B'로 잘라낸다. 격자는 동률이 흔해서
+  //   그대로면 U0 전체가 같은 거리일 때 U = ∅ 이 되어 상위 루프가 진전 없이 반복된다.
+  //   그래서 마지막 거리의 동률까지 모두 확정하고, B'는 힙에 남은 유효 최솟값으로 둔다
+  //   (U0 < B' ≤ 나머지, U0는 Dijkstra 순서로 확정됐으므로 전부 완료 정점).
+  Result base_case(double B, const std::vector<int>& S) {
+    const uint32_t st = next_stamp();
+    using Item = std::pair<double,int>;
+    std::priority_queue<Item, std::vector<Item>, std::greater<Item>> heap;
+    for (int x : S) heap.push({ g(x), x });
+
+    // 옛 항목/이미 확정된 정점 제거 후 유효 최솟값 (없으면 +∞)
+    auto top_live = [&]() -> double {
+      while (!heap.empty()) {
+        auto [d, u] = heap.top();
+        if (bmark_[u] != st && d == g(u)) return d;
+        heap.pop();
+      }
+      return std::numeric_limits<double>::infinity();
+    };
+
+    std::vector<int> U0;
+    double last = -1.0;
+    for (;;) {
+      const double d = top_live();
+      if (heap.empty()) break;
+      if (U0.size() >= (size_t)k_ + 1 && d != last) break;
+      const int u = heap.top().second; heap.pop();
+      bmark_[u] = st;
+      U0.push_back(u);
+      last = d;
+      for_each_edge(u, [&](int v, double w) {
+        const double nd = d + w;
+        if (nd <= g(v) && nd < B) {
+          if (nd < g(v)) ctx_->set(v, nd, u);
+          heap.push({ nd, v });
+        }
+      });
+    }
+
+    note_complete(U0);
+    const double rest = top_live();
+    return { heap.empty() ? B : rest, std::move(U0) };
+  }
+
+  void note_complete(const std::vector<int>& U) {
+    for (int v : U) if (v == gId_) { goal_done_ = true; return; }
+  }
+
+  Result bmssp(int l, double B, const std::vector<int>& S) {
+    if (l == 0) return base_case(B, S);
+
+    auto [Pv, Wset] = find_pivots(B, S);
+
+    const size_t M = size_t(1) << std::min(62, (l-1) * t_);
+    const size_t limit = (size_t)k_ << std::min(60, l * t_);
+    DS D;
+    D.reset(M, B);
+    double Bp = std::numeric_limits<double>::infinity(); // B'_0 = min d̂[P]
+    for (int x : Pv) { D.insert((size_t)x, g(x)); ++pushes_; Bp = std::min(Bp, g(x)); }
+
+    const uint32_t cid = next_stamp();
+    auto& inU = in_u_[l];
+    std::vector<int> U;
+    std::vector<std::pair<size_t,double>> K;
+    std::vector<int> Si;
+
+    while (U.size() < limit && !D.is_empty()) {
+      auto [Bi, pulled] = D.pull();
+      pulls_ += pulled.size();
+      Si.assign(pulled.begin(), pulled.end());
+
+      auto [Bpi, Ui] = bmssp(l-1, Bi, Si);
+      if (goal_done_) return {};
+
+      for (int u : Ui) if (inU[u] != cid) { inU[u] = cid; U.push_back(u); }
+
+      K.clear();
+      for (int u : Ui) {
+        const double gu = g(u);
+        for_each_edge(u, [&](int v, double w) {
+          const double nd = gu + w;
+          if (nd <= g(v)) {
+            if (nd < g(v)) ctx_->set(v, nd, u);
+            if (nd >= Bi && nd < B)        { D.insert((size_t)v, nd); ++pushes_; }
+            else if (nd >= Bpi && nd < Bi) K.emplace_back((size_t)v, nd);
+          }
+        });
+      }
+      for (int x : Si) {
+        const double gx = g(x);
+        if (gx >= Bpi && gx < Bi) K.emplace_back((size_t)x, gx);
+      }
+      pushes_ += K.size();
+      D.batch_prepend(K);
+      Bp = Bpi;
+    }
+
+    const double Bout = std::min(Bp, B);
+    for (int x : Wset) if (g(x) < Bout && inU[x] != cid) { inU[x] = cid; U.push_back(x); }
+    if (g(gId_) < Bout && inU[gId_] == cid) goal_done_ = true;
+    return { Bout, std::move(U) };
+  }
+
+  Params P;
+
+  // 쿼리 상태
+  pathlab::SearchContext* ctx_{nullptr};
+  const G* graph_{nullptr};
+  pathlab::GridGraph grid_;   // 격자 질의용 뷰 (G = GridGraph일 때만 사용)
+  int gId_{-1};
+  int k_{1}, t_{1};
+  bool goal_done_{false};
+  uint64_t scans_{0}, pushes_{0}, pulls_{0};
+
+  // 스크래치 (스탬프로 O(1) 리셋)
+  uint32_t stamp_{0};
+  std::vector<uint32_t> wmark_, smark_, lmark_, rstamp_, bmark_;
+  std::vector<int> root_, cnt_;
+  std::vector<std::vector<uint32_t>> in_u_; // 레벨별 "이 호출의 U에 있음"
+};
+
+} // namespace pathlab::dmm
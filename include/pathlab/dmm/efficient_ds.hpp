@@ -1,86 +1,240 @@
 #pragma once
 #include <vector>
-#include <deque>
+#include <list>
+#include <map>
+#include <unordered_map>
 #include <utility>
 #include <limits>
 #include <algorithm>
+#include <optional>
+#include <cmath>
 
 namespace pathlab::dmm {
 
+// BMSSP의 D 구조 (Duan et al. Lemma 3.3) — 블록 연결 리스트 구현
+// - D0: batch_prepend 블록열 (앞일수록 작은 값), D1: insert 블록열 (상한 ub 오름차순).
+//   D1은 std::map<ub, 블록>으로 "값 이상인 최소 상한" 블록을 찾아 넣고,
+//   크기가 block_size(M)를 넘으면 nth_element 중앙값으로 둘로 나눈다.
+// - batch_prepend(L): |L| ≤ M이면 블록 하나, 아니면 중앙값 분할을 반복해 ⌈M/2⌉ 이하 블록들로 앞에 붙인다.
+// - 정점당 최소 거리 하나만 유지: 더 작은 값이 오면 기존 항목을 지우고 넣는다 (위치 맵).
+// - 분할은 값 기준으로 엄격히 나눠(왼쪽 < 오른쪽) 같은 값이 두 블록에 걸치지 않는다.
+//   (전부 동률이면 분할하지 않음)
+// - pull(): D0/D1 앞쪽에서 각각 M개 이상이 될 때까지 블록을 모아 가장 작은 M개(+ 동률)를 반환,
+//   경계 x는 남은 최솟값 (반환값 < x ≤ 남은 값, 비면 bound).
+// - 블록별 최소값을 유지하므로 peek_min O(1).
 struct EfficientDataStructure {
   using Item = std::pair<size_t, double>; // (vertex, distance)
 
-  std::deque<std::vector<Item>> batch_blocks; // 큐: 미정렬 배치 (먼저 소진)
-  std::vector<std::vector<Item>> sorted_blocks; // 스택: 미정렬 배치 (나중 소진)
-  size_t block_size{0};
+  struct Block {
+    std::vector<Item> items;
+    double ub{std::numeric_limits<double>::infinity()};  // D1 전용 상한
+    double min{std::numeric_limits<double>::infinity()};
+  };
+  using BlockList = std::list<Block>;
+  using BlockIt   = BlockList::iterator;
+
+  size_t block_size{1};
   double bound{std::numeric_limits<double>::infinity()};
 
-  EfficientDataStructure() = default;
-  EfficientDataStructure(size_t block, double bnd)
-  : block_size(block), bound(bnd) {}
+  EfficientDataStructure() { reset(1, std::numeric_limits<double>::infinity()); }
+  EfficientDataStructure(size_t block, double bnd) { reset(block, bnd); }
+
+  // 블록 반복자가 자기 리스트를 가리키므로 복사/이동 금지
+  EfficientDataStructure(const EfficientDataStructure&) = delete;
+  EfficientDataStructure& operator=(const EfficientDataStructure&) = delete;
 
   void reset(size_t block, double bnd) {
-    batch_blocks.clear();
-    sorted_blocks.clear();
-    block_size = block;
+    block_size = std::max<size_t>(block, 1);
     bound = bnd;
+    d0_.clear(); d1_.clear(); ub_index_.clear(); loc_.clear();
+    size_ = 0;
+    // D1은 상한 bound인 빈 블록 하나로 시작 (항상 유지)
+    d1_.push_back(Block{ {}, bound, INF });
+    ub_index_.emplace(bound, std::prev(d1_.end()));
   }
 
-  // Rust: insert(vertex, distance)
   void insert(size_t v, double d) {
-    if (d >= bound || !std::isfinite(d)) return;
-    if (sorted_blocks.empty() || sorted_blocks.back().size() >= block_size) {
-      sorted_blocks.emplace_back();
-      sorted_blocks.back().reserve(block_size);
-    }
-    sorted_blocks.back().emplace_back(v, d);
+    if (!(d < bound) || !std::isfinite(d)) return;
+    if (!take_if_better(v, d)) return;
+    BlockIt b = ub_index_.lower_bound(d)->second;
+    put(b, false, v, d);
+    if (b->items.size() > block_size) split_d1(b);
   }
 
-  // Rust: batch_prepend(items)
   void batch_prepend(std::vector<Item> items) {
-    if (items.empty()) return;
-    batch_blocks.emplace_front(std::move(items));
+    // 같은 정점은 가장 작은 값만
+    std::sort(items.begin(), items.end());
+    std::vector<Item> L;
+    L.reserve(items.size());
+    for (size_t i = 0; i < items.size(); ++i) {
+      if (i > 0 && items[i].first == items[i-1].first) continue;
+      const auto [v, d] = items[i];
+      if (!(d < bound) || !std::isfinite(d)) continue;
+      if (!take_if_better(v, d)) continue;
+      L.push_back(items[i]);
+    }
+    if (L.empty()) return;
+
+    std::vector<std::vector<Item>> chunks;
+    if (L.size() <= block_size) chunks.push_back(std::move(L));
+    else split_rec(std::move(L), std::max<size_t>(1, (block_size + 1) / 2), chunks);
+
+    // 큰 값 청크부터 앞에 붙여 D0 앞쪽이 가장 작게
+    for (auto c = chunks.rbegin(); c != chunks.rend(); ++c) {
+      d0_.push_front(Block{ std::move(*c), INF, INF });
+      BlockIt b = d0_.begin();
+      b->min = min_of(b->items);
+      reindex(b, true);
+      size_ += b->items.size();
+    }
   }
 
-  // Rust: pull() -> (min_remaining, vertices)
+  // pull() -> (x, 가장 작은 M개 + 동률 정점)
   std::pair<double, std::vector<size_t>> pull() {
-    if (!batch_blocks.empty()) {
-      auto blk = std::move(batch_blocks.front());
-      batch_blocks.pop_front();
-      std::sort(blk.begin(), blk.end(),
-                [](const Item& a, const Item& b){ return a.second < b.second; });
-      std::vector<size_t> vs; vs.reserve(blk.size());
-      for (auto& it : blk) vs.push_back(it.first);
-      return { peek_min().value_or(bound), std::move(vs) };
+    std::vector<size_t> out;
+    if (size_ == 0) return { bound, std::move(out) };
+
+    // 두 블록열의 앞쪽에서 각각 M개 이상 모으기
+    std::vector<std::pair<BlockIt,bool>> taken;
+    std::vector<double> vals;
+    BlockIt n0 = d0_.begin(), n1 = d1_.begin();
+    for (size_t c = 0; n0 != d0_.end() && c < block_size; ++n0) {
+      taken.push_back({ n0, true }); c += n0->items.size();
+      for (auto& it : n0->items) vals.push_back(it.second);
     }
-    if (!sorted_blocks.empty()) {
-      auto blk = std::move(sorted_blocks.back());
-      sorted_blocks.pop_back();
-      std::sort(blk.begin(), blk.end(),
-                [](const Item& a, const Item& b){ return a.second < b.second; });
-      std::vector<size_t> vs; vs.reserve(blk.size());
-      for (auto& it : blk) vs.push_back(it.first);
-      return { peek_min().value_or(bound), std::move(vs) };
+    for (size_t c = 0; n1 != d1_.end() && c < block_size; ++n1) {
+      taken.push_back({ n1, false }); c += n1->items.size();
+      for (auto& it : n1->items) vals.push_back(it.second);
     }
-    return { bound, {} };
-  }
 
-  // Rust: peek_min()
-  std::optional<double> peek_min() const {
-    double batch_min = std::numeric_limits<double>::infinity();
-    for (auto const& blk : batch_blocks) {
-      for (auto const& it : blk) batch_min = std::min(batch_min, it.second);
+    // cut: 반환할 최댓값 (M번째 값, 모은 게 M개 이하면 전부)
+    double cut = INF;
+    if (vals.size() > block_size) {
+      std::nth_element(vals.begin(), vals.begin() + (block_size - 1), vals.end());
+      cut = vals[block_size - 1];
     }
-    double sorted_min = std::numeric_limits<double>::infinity();
-    for (auto const& blk : sorted_blocks) {
-      for (auto const& it : blk) sorted_min = std::min(sorted_min, it.second);
+    // x: 남는 값의 최솟값 (모은 블록의 나머지 + 각 블록열의 다음 블록)
+    double x = INF;
+    for (double d : vals) if (d > cut) x = std::min(x, d);
+    if (n0 != d0_.end()) x = std::min(x, n0->min);
+    if (n1 != d1_.end()) x = std::min(x, n1->min);
+    if (!(cut < x)) cut = std::nextafter(x, -INF); // 블록 경계의 동률 안전망: x 미만만 반환
+    if (x == INF) x = bound;
+
+    // 모은 블록에서 cut 이하 항목 제거
+    for (auto [b, in_d0] : taken) {
+      auto& its = b->items;
+      size_t keep = 0;
+      for (size_t i = 0; i < its.size(); ++i) {
+        if (its[i].second <= cut) { out.push_back(its[i].first); loc_.erase(its[i].first); --size_; }
+        else its[keep++] = its[i];
+      }
+      its.resize(keep);
+      b->min = min_of(its);
+      reindex(b, in_d0);
+      if (its.empty()) drop_block(b, in_d0);
     }
-    double m = std::min(batch_min, sorted_min);
+    return { x, std::move(out) };
+  }
+
+  // 남은 최솟값 O(1): D0 첫 블록과 D1 첫 블록 (블록열이 값 순서로 정렬되어 있음)
+  std::optional<double> peek_min() const {
+    double m = INF;
+    if (!d0_.empty()) m = std::min(m, d0_.front().min);
+    m = std::min(m, d1_.front().min);
     return std::isfinite(m) ? std::optional<double>(m) : std::nullopt;
   }
 
-  bool is_empty() const {
-    return batch_blocks.empty() && sorted_blocks.empty();
+  bool is_empty() const { return size_ == 0; }
+  size_t size() const { return size_; }
+
+private:
+  struct Loc { BlockIt blk; uint32_t idx; bool d0; };
+  static constexpr double INF = std::numeric_limits<double>::infinity();
+
+  BlockList d0_, d1_;
+  std::map<double, BlockIt> ub_index_;   // D1 상한 → 블록
+  std::unordered_map<size_t, Loc> loc_;  // 정점 → 위치
+  size_t size_{0};
+
+  static double min_of(const std::vector<Item>& its) {
+    double m = INF;
+    for (auto& it : its) m = std::min(m, it.second);
+    return m;
+  }
+
+  void reindex(BlockIt b, bool d0) {
+    for (uint32_t i = 0; i < b->items.size(); ++i) loc_[b->items[i].first] = Loc{ b, i, d0 };
+  }
+
+  void put(BlockIt b, bool d0, size_t v, double d) {
+    b->items.emplace_back(v, d);
+    loc_[v] = Loc{ b, (uint32_t)(b->items.size() - 1), d0 };
+    b->min = std::min(b->min, d);
+    ++size_;
+  }
+
+  // v가 없거나 d가 더 작으면 기존 항목을 지우고 true
+  bool take_if_better(size_t v, double d) {
+    auto it = loc_.find(v);
+    if (it == loc_.end()) return true;
+    const Loc L = it->second;
+    auto& its = L.blk->items;
+    const double old = its[L.idx].second;
+    if (!(d < old)) return false;
+
+    its[L.idx] = its.back();
+    loc_[its[L.idx].first].idx = L.idx;
+    its.pop_back();
+    loc_.erase(v);
+    --size_;
+    if (old == L.blk->min) L.blk->min = min_of(its);
+    if (its.empty()) drop_block(L.blk, L.d0);
+    return true;
+  }
+
+  void drop_block(BlockIt b, bool d0) {
+    if (d0) { d0_.erase(b); return; }
+    if (b->ub == bound) return; // 마지막 D1 블록은 유지
+    ub_index_.erase(b->ub);
+    d1_.erase(b);
+  }
+
+  // 중앙값 기준 엄격 분할: left < right. 모두 동률이면 false
+  static bool split_at_median(std::vector<Item>& xs, std::vector<Item>& left, std::vector<Item>& right) {
+    const size_t mid = xs.size() / 2;
+    std::nth_element(xs.begin(), xs.begin() + mid, xs.end(),
+                     [](const Item& a, const Item& b){ return a.second < b.second; });
+    const double p = xs[mid].second;
+    left.clear(); right.clear();
+    for (auto& it : xs) (it.second <= p ? left : right).push_back(it);
+    if (right.empty()) {
+      left.clear();
+      for (auto& it : xs) (it.second < p ? left : right).push_back(it);
+    }
+    return !left.empty() && !right.empty();
+  }
+
+  void split_d1(BlockIt b) {
+    std::vector<Item> left, right;
+    if (!split_at_median(b->items, left, right)) return;
+    Block lb{ std::move(left), -INF, INF };
+    for (auto& it : lb.items) lb.ub = std::max(lb.ub, it.second);
+    lb.min = min_of(lb.items);
+    b->items = std::move(right);
+    b->min = min_of(b->items);
+    BlockIt li = d1_.insert(b, std::move(lb));
+    ub_index_.emplace(li->ub, li);
+    reindex(li, false);
+    reindex(b, false);
+  }
+
+  static void split_rec(std::vector<Item>&& xs, size_t cap, std::vector<std::vector<Item>>& out) {
+    if (xs.size() <= cap) { out.push_back(std::move(xs)); return; }
+    std::vector<Item> left, right;
+    if (!split_at_median(xs, left, right)) { out.push_back(std::move(xs)); return; }
+    split_rec(std::move(left), cap, out);
+    split_rec(std::move(right), cap, out);
   }
 };
 
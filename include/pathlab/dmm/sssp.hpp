@@ -2,22 +2,28 @@
 #include <vector>
 #include <limits>
 #include <chrono>
-#include <cmath>
 #include "pathlab/algorithms/ipathfinder.hpp"
+#include "pathlab/algorithms/search_context.hpp"
 #include "pathlab/core/grid_map.hpp"
+#include "pathlab/core/graph.hpp"
+#include "pathlab/core/csr_graph.hpp"
 #include "pathlab/dmm/efficient_ds.hpp"   // 블록 기반 부분정렬 DS
+#include "pathlab/dmm/bmssp.hpp"
 
 namespace pathlab::dmm {
 
-// DMM 스타일(전역 힙 X, 블록 단위 부분정렬) SSSP 스켈레톤
-// - 정확한 최단경로 유지
-// - 큐는 EfficientDataStructure (pull 시 블록만 정렬)
-// - allow_diagonal, corner-cutting 처리 동일
+// DMM SSSP 진입점
+// - 기본: 재귀 BMSSP 엔진 (bmssp.hpp, D = EfficientDataStructure, Params::adaptive_ds면 힙 기반 D)
+// - Params::legacy: 예전 스켈레톤 (전역 힙 X, 블록 단위 부분정렬, 블록 간 순서 보장 없음 → 비정확)
+//   큐는 EfficientDataStructure (pull 시 블록만 정렬), allow_diagonal, corner-cutting 처리 동일
+// - 격자(GridMap)와 명시적 그래프(CsrGraph) 모두 같은 엔진 (SearchGraph, core/graph.hpp)
 class SSSP {
 public:
   struct Params {
-    size_t block_size = 1024;   // pull할 때 정렬하는 배치(블록) 크기
-    double bound = std::numeric_limits<double>::infinity(); // BMSSP 용 상한 (무한이면 전체)
+    size_t block_size = 1024;   // legacy: pull할 때 정렬하는 배치(블록) 크기
+    double bound = std::numeric_limits<double>::infinity(); // legacy: 거리 상한 (무한이면 전체)
+    bool legacy = false;        // true면 예전 스켈레톤 경로
+    bool adaptive_ds = false;   // BMSSP의 D를 AdaptiveDataStructure로
   };
 
   SSSP() : P() {}                       
@@ -26,38 +32,53 @@ public:
   pathlab::PathResult solve(const pathlab::GridMap& map,
                             int sx, int sy, int gx, int gy,
                             bool allow_diagonal = true) {
-    PathResult r;
+    pathlab::SearchContext ctx;
+    return solve(ctx, map, sx, sy, gx, gy, allow_diagonal);
+  }
+
+  // ctx를 쿼리 간 재사용 (O(1) 리셋)
+  pathlab::PathResult solve(pathlab::SearchContext& ctx, const pathlab::GridMap& map,
+                            int sx, int sy, int gx, int gy,
+                            bool allow_diagonal = true) {
+    if (!P.legacy) {
+      return P.adaptive_ds ? adaptive_.solve(ctx, map, sx, sy, gx, gy, allow_diagonal)
+                           : engine_.solve(ctx, map, sx, sy, gx, gy, allow_diagonal);
+    }
 
     const int W = map.width(), H = map.height();
-    if (W<=0 || H<=0) return r;
-    if (sx<0||sy<0||gx<0||gy<0||sx>=W||gx>=W||sy>=H||gy>=H) return r;
-    if (!map.is_free(sx,sy) || !map.is_free(gx,gy)) return r;
+    if (W<=0 || H<=0) return {};
+    if (sx<0||sy<0||gx<0||gy<0||sx>=W||gx>=W||sy>=H||gy>=H) return {};
+    if (!map.is_free(sx,sy) || !map.is_free(gx,gy)) return {};
+
+    // 내부 탐색은 패딩 ID 공간 (범위 검사 없음), 4/8방 이웃 (MovingAI 표준: 직교=1, 대각=√2)
+    pathlab::PathResult r = legacy(ctx, pathlab::GridGraph(map, allow_diagonal),
+                                   map.to_padded(sx,sy), map.to_padded(gx,gy));
+    for (int& v : r.path) v = map.from_padded(v);
+    return r;
+  }
 
-    const int N = W*H;
-    auto id = [W](int x,int y){ return y*W + x; };
-    auto xy = [W](int v){ return std::pair<int,int>{ v%W, v/W }; };
+  // 명시적 그래프 (CsrGraph): 노드 s → t, path도 노드 ID
+  pathlab::PathResult solve(pathlab::SearchContext& ctx, const pathlab::CsrGraph& graph, int s, int t) {
+    if (!P.legacy) return P.adaptive_ds ? csr_adaptive_.solve(ctx, graph, s, t) : csr_engine_.solve(ctx, graph, s, t);
+    const int n = (int)graph.node_count();
+    if (s<0||t<0||s>=n||t>=n) return {};
+    return legacy(ctx, graph, s, t);
+  }
 
-    const int sId = id(sx,sy), gId = id(gx,gy);
+private:
+  template <SearchGraph G>
+  pathlab::PathResult legacy(pathlab::SearchContext& ctx, const G& graph, int sId, int gId) {
+    PathResult r;
     const double INF = std::numeric_limits<double>::infinity();
 
-    std::vector<double> dist(N, INF);
-    std::vector<int>    parent(N, -1);
-    std::vector<char>   closed(N, 0);
-
-    // 4/8방 이웃 (MovingAI 표준: 직교=1, 대각=√2)
-    static const int DX[8] = { 1,-1, 0, 0, 1, 1,-1,-1 };
-    static const int DY[8] = { 0, 0, 1,-1, 1,-1, 1,-1 };
-    static const double WC[8] = {
-      1.0, 1.0, 1.0, 1.0, std::sqrt(2.0), std::sqrt(2.0), std::sqrt(2.0), std::sqrt(2.0)
-    };
-    const int NB = allow_diagonal ? 8 : 4;
+    ctx.begin(graph.node_count());
 
     auto t0 = std::chrono::steady_clock::now();
 
     // ★ 전역 우선순위큐 대신, 블록 DS 사용
     EfficientDataStructure ds(P.block_size, P.bound);
 
-    dist[sId] = 0.0;
+    ctx.set(sId, 0.0, -1);
     ds.insert((size_t)sId, 0.0);
 
     uint64_t expanded = 0;
@@ -68,33 +89,23 @@ public:
       if (batch.empty()) break;
 
       for (size_t u : batch) {
-        if (closed[u]) continue;
-        if ((int)u == gId) { closed[u] = 1; goto DONE; }
-        closed[u] = 1;
+        if (ctx.closed((int)u)) continue;
+        if ((int)u == gId) { ctx.close((int)u); goto DONE; }
+        ctx.close((int)u);
         ++expanded;
 
-        auto [ux,uy] = xy((int)u);
-        for (int k=0;k<NB;++k) {
-          int vx = ux + DX[k], vy = uy + DY[k];
-          if (vx<0||vy<0||vx>=W||vy>=H) continue;
-          if (!map.is_free(vx,vy)) continue;
+        const double gu = ctx.g((int)u);
+        // 격자면 유효 이동(corner-cutting 금지 포함)은 로드 시 마스크로 계산되어 있음
+        graph.for_each_out((int)u, [&](int v, double w) {
+          if (ctx.closed(v)) return;
 
-          // 대각선 corner-cutting 방지
-          if (k>=4){
-            if (!map.is_free(ux+DX[k], uy) || !map.is_free(ux, uy+DY[k])) continue;
-          }
-
-          int v = id(vx,vy);
-          if (closed[v]) continue;
-
-          double nd = dist[u] + WC[k];
-          if (nd < dist[v]) {
-            dist[v] = nd;
-            parent[v] = (int)u;
+          double nd = gu + w;
+          if (nd < ctx.g(v)) {
+            ctx.set(v, nd, (int)u);
             // 전역 힙 대신 배치 컨테이너에 삽입
             if (nd < P.bound) ds.insert((size_t)v, nd);
           }
-        }
+        });
       }
     }
 
@@ -103,19 +114,22 @@ DONE:
     r.stats.millis   = std::chrono::duration<double,std::milli>(t1-t0).count();
     r.stats.expanded = expanded;
 
-    if (dist[gId] == INF) { r.found=false; return r; }
+    if (ctx.g(gId) == INF) { r.found=false; return r; }
     r.found = true;
-    r.cost  = dist[gId];
+    r.cost  = ctx.g(gId);
 
     // 경로 복원
     std::vector<int> rev;
-    for (int v=gId; v!=-1; v=parent[v]) rev.push_back(v);
+    for (int v=gId; v!=-1; v=ctx.parent(v)) rev.push_back(v);
     r.path.assign(rev.rbegin(), rev.rend());
     return r;
   }
 
-private:
   Params P;
+  BMSSP<EfficientDataStructure> engine_;
+  BMSSP<AdaptiveDataStructure>  adaptive_;
+  BMSSP<EfficientDataStructure, pathlab::CsrGraph> csr_engine_;
+  BMSSP<AdaptiveDataStructure,  pathlab::CsrGraph> csr_adaptive_;
 };
 
 } // namespace pathlab::dmm
@@ -0,0 +1,34 @@
+// include/pathlab/io/mapped_file.hpp
+#pragma once
+#include <cstddef>
+#include <string>
+
+namespace pathlab {
+
+// 읽기 전용 mmap 파일 (POSIX). 닫을 때/소멸 시 munmap.
+// - 맵/시나리오 로더가 파일 전체를 한 번에 보고 파싱하거나(ASCII) 그대로 가리킨다(바이너리).
+// - 크기 0인 파일은 열리지만 data()가 nullptr.
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile() { close(); }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& o) noexcept : data_(o.data_), size_(o.size_) { o.data_ = nullptr; o.size_ = 0; }
+    MappedFile& operator=(MappedFile&& o) noexcept {
+        if (this != &o) { close(); data_ = o.data_; size_ = o.size_; o.data_ = nullptr; o.size_ = 0; }
+        return *this;
+    }
+
+    bool open(const std::string& filepath);
+    void close();
+
+    const char* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    const char* data_{nullptr};
+    size_t size_{0};
+};
+
+} // namespace pathlab
@@ -1,25 +1,53 @@
 // include/pathlab/io/scen_loader.hpp
 #pragma once
+#include <cstdint>
 #include <string>
 #include <vector>
 #include "pathlab/core/grid_map.hpp"
 
 namespace pathlab {
 
+// 시나리오 한 줄 (열 저장소에서 꺼낸 값 사본). 맵 이름은 ScenarioLoader::map_name(map_id).
 struct Scenario {
     Coord start;
     Coord goal;
     double optimal_length;
-    std::string map_name;
+    int bucket;
+    uint32_t map_id;
 };
 
+// MovingAI .scen 로더: 열 단위(SoA) 저장
+// - 파일을 mmap으로 열고 from_chars로 파싱 (줄별 문자열/스트림 생성 없음).
+// - threads > 1이면 버퍼를 줄 경계에서 나눠 병렬 파싱 후 파일 순서대로 이어 붙인다.
+// - 맵 이름은 한 번만 저장(intern)하고 행마다 map_id만 둔다.
+// - 파싱되지 않는 줄(version 헤더 등)은 건너뛴다.
 class ScenarioLoader {
 public:
-    bool load_from_file(const std::string& filepath);
-    const std::vector<Scenario>& scenarios() const { return scenarios_; }
+    bool load_from_file(const std::string& filepath, unsigned threads = 1);
+
+    size_t size() const { return sx_.size(); }
+    bool empty() const { return sx_.empty(); }
+    Scenario operator[](size_t i) const {
+        return { { sx_[i], sy_[i] }, { gx_[i], gy_[i] }, opt_[i], bucket_[i], map_id_[i] };
+    }
+
+    // 열 접근
+    const std::vector<int32_t>&  sx() const { return sx_; }
+    const std::vector<int32_t>&  sy() const { return sy_; }
+    const std::vector<int32_t>&  gx() const { return gx_; }
+    const std::vector<int32_t>&  gy() const { return gy_; }
+    const std::vector<double>&   optimal() const { return opt_; }
+    const std::vector<int32_t>&  buckets() const { return bucket_; }
+    const std::vector<uint32_t>& map_ids() const { return map_id_; }
+
+    const std::vector<std::string>& map_names() const { return map_names_; }
+    const std::string& map_name(uint32_t id) const { return map_names_[id]; }
 
 private:
-    std::vector<Scenario> scenarios_;
+    std::vector<int32_t>  sx_, sy_, gx_, gy_, bucket_;
+    std::vector<double>   opt_;
+    std::vector<uint32_t> map_id_;
+    std::vector<std::string> map_names_;
 };
 
 } // namespace pathlab
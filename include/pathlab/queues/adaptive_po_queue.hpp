@@ -0,0 +1,171 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include "pathlab/queues/ipriority_queue.hpp"
+
+namespace pathlab {
+
+// Self-tuning 2단 버킷 큐 (POQueue의 SCALE/K/GRAIN 수동 튜닝 대체)
+// - L0: K0개 세밀 버킷 [base0, end0). 커서 버킷만 힙으로 만들어 pop → 순서 오차 없음.
+// - L1: K1개 거친 버킷 [base1, base1 + K1·W1). L0은 항상 L1 커서 버킷 안에 있다 (end0 ≤ 그 버킷 끝).
+// - overflow: L1 범위 밖 키 (spill). L1이 다 비면 overflow 전체로 L1을 다시 만든다.
+// - 폭 자동 선택:
+//   L0 refill: 옮겨오는 L1 버킷 원소 n개의 키 범위 s → 버킷당 약 TARGET개가 되도록 w = s / clamp(n/TARGET, 1, K0).
+//   L1 rebuild: overflow 키 범위 s → W1 = 2s / (K1-1) (모두 한 번에 L1로 들어가고 절반은 이후 push 여유).
+//   범위가 0이면 이전 폭 유지.
+// - 원소는 overflow → L1 → L0 으로 레벨당 한 번만 이동 → refill/rebuild 상각 O(1).
+// - 키 단조 비감소 pop 가정(Dijkstra 계열). L0 시작보다 작은 키는 버킷 0으로 (순서는 힙이 보장).
+// - refill_count(): L1→L0 재분배 횟수, spill_count(): overflow로 간 push 수,
+//   rebuild_count(): overflow→L1 재구성 횟수, bucket_width(): 현재 L0 폭.
+template <class KeyT=int, uint32_t K0=256, uint32_t K1=256>
+class AdaptivePOQueue final : public IPriorityQueue<KeyT,double> {
+  static_assert(K0 >= 2 && K1 >= 2, "K0, K1 must be >= 2");
+public:
+  AdaptivePOQueue(){ clear(); }
+
+  void clear() override {
+    for (auto &b: l0_) b.clear();
+    for (auto &b: l1_) b.clear();
+    overflow_.clear();
+    l1_active_ = false;
+    base0_ = end0_ = 0.0;
+    w0_ = 1.0 / K0;
+    base1_ = 0.0; w1_ = 1.0;
+    cur0_ = K0; cur1_ = K1;
+    heap_ready_ = false;
+    of_min_ = INF; of_max_ = -INF;
+    sz_ = 0; l0_sz_ = 0;
+    pushes_ = pops_ = 0;
+    peak_ = 0;
+    refills_ = spills_ = rebuilds_ = 0;
+  }
+
+  // --- IPriorityQueue ---
+  void push(const KeyT& k, double prio) override {
+    if (!(prio > 0)) prio = 0.0;  // 음수/NaN 안전망
+    // end0 ≤ L1 커서 버킷 끝 ≤ 나머지 L1/overflow 키 → L0가 비어 있어도 end0 미만은 L0로
+    if (prio < end0_) {
+      push_l0(prio, k);
+    } else if (l1_active_ && prio < l1_end()) {
+      uint32_t i = (uint32_t)std::min<double>((prio - base1_) / w1_, K1 - 1);
+      if (prio < base1_ || i < cur1_) i = cur1_;
+      l1_[i].emplace_back(prio, k);
+    } else {
+      overflow_.emplace_back(prio, k);
+      of_min_ = std::min(of_min_, prio);
+      of_max_ = std::max(of_max_, prio);
+      ++spills_;
+    }
+    ++sz_; ++pushes_;
+    if (sz_ > peak_) peak_ = sz_;
+  }
+
+  std::optional<KeyT> pop() override {
+    if (sz_ == 0) return std::nullopt;
+    if (l0_sz_ == 0 && !refill()) return std::nullopt;
+
+    while (l0_[cur0_].empty()) { ++cur0_; heap_ready_ = false; }
+    auto &b = l0_[cur0_];
+    if (!heap_ready_) { std::make_heap(b.begin(), b.end(), std::greater<Pair>{}); heap_ready_ = true; }
+    std::pop_heap(b.begin(), b.end(), std::greater<Pair>{});
+    const KeyT k = b.back().second;
+    b.pop_back();
+    --sz_; --l0_sz_; ++pops_;
+    return k;
+  }
+
+  bool empty() const override { return sz_ == 0; }
+  size_t size()  const override { return sz_; }
+
+  // --- stats ---
+  uint64_t push_count() const override { return pushes_; }
+  uint64_t pop_count()  const override { return pops_;  }
+  void reset_stats()    override { pushes_ = pops_ = refills_ = spills_ = rebuilds_ = 0; peak_ = sz_; }
+  size_t peak_size()    const override { return peak_; }
+  uint64_t refill_count()  const { return refills_; }
+  uint64_t spill_count()   const { return spills_; }
+  uint64_t rebuild_count() const { return rebuilds_; }
+  double   bucket_width()  const { return w0_; }
+
+private:
+  using Pair = std::pair<double, KeyT>; // (prio, id)
+  static constexpr double INF = std::numeric_limits<double>::infinity();
+  static constexpr uint32_t TARGET = 2; // L0 버킷당 목표 원소 수
+
+  std::vector<Pair> l0_[K0];
+  std::vector<Pair> l1_[K1];
+  std::vector<Pair> overflow_;
+  bool     l1_active_{false};
+  double   base0_{0.0}, end0_{0.0}, w0_{1.0 / K0};
+  double   base1_{0.0}, w1_{1.0};
+  uint32_t cur0_{K0}, cur1_{K1};
+  bool     heap_ready_{false};   // l0_[cur0_]가 힙 상태인지
+  double   of_min_{INF}, of_max_{-INF};
+  size_t   sz_{0}, l0_sz_{0};
+  uint64_t pushes_{0}, pops_{0};
+  size_t   peak_{0};
+  uint64_t refills_{0}, spills_{0}, rebuilds_{0};
+
+  double l1_end() const { return base1_ + K1 * w1_; }
+
+  void push_l0(double prio, const KeyT& k) {
+    uint32_t i = prio < base0_ ? 0u : (uint32_t)std::min<double>((prio - base0_) / w0_, K0 - 1);
+    auto &b = l0_[i];
+    b.emplace_back(prio, k);
+    ++l0_sz_;
+    if (i < cur0_) { cur0_ = i; heap_ready_ = false; }
+    else if (i == cur0_ && heap_ready_) std::push_heap(b.begin(), b.end(), std::greater<Pair>{});
+  }
+
+  // L0가 비었을 때: 다음 L1 버킷(없으면 overflow로 L1 재구성)을 L0로 분배
+  bool refill() {
+    for (;;) {
+      if (l1_active_) {
+        while (cur1_ < K1 && l1_[cur1_].empty()) ++cur1_;
+        if (cur1_ < K1) break;
+      }
+      if (overflow_.empty()) return false;
+      rebuild_l1();
+    }
+
+    auto &src = l1_[cur1_];
+    double lo = INF, hi = -INF;
+    for (auto &kv : src) { lo = std::min(lo, kv.first); hi = std::max(hi, kv.first); }
+    const double spread = hi - lo;
+    const size_t used = std::clamp<size_t>(src.size() / TARGET, 1, K0);
+    if (spread > 0) w0_ = spread / used * (1.0 + 1e-9);
+    base0_ = lo;
+    const double bucket_end = base1_ + (cur1_ + 1) * w1_;
+    end0_ = std::min(base0_ + K0 * w0_, bucket_end);
+    if (!(end0_ > hi)) end0_ = std::nextafter(hi, INF); // 원소는 모두 L0로
+
+    cur0_ = K0; heap_ready_ = false;
+    for (auto &kv : src) push_l0(kv.first, kv.second);
+    src.clear();
+    ++refills_;
+    return true;
+  }
+
+  void rebuild_l1() {
+    const double spread = of_max_ - of_min_;
+    if (spread > 0) w1_ = 2.0 * spread / (K1 - 1); // 절반은 이후 push 여유
+    base1_ = of_min_;
+    for (auto &kv : overflow_) {
+      const uint32_t i = (uint32_t)std::min<double>((kv.first - base1_) / w1_, K1 - 1);
+      l1_[i].push_back(kv);
+    }
+    overflow_.clear();
+    of_min_ = INF; of_max_ = -INF;
+    l1_active_ = true;
+    cur1_ = 0;
+    ++rebuilds_;
+  }
+};
+
+} // namespace pathlab
@@ -1,5 +1,5 @@
 #pragma once
-#include <queue>
+#include <algorithm>
 #include <vector>
 #include <utility>
 #include <functional>
@@ -9,32 +9,40 @@
 namespace pathlab {
 
 // Key: 정수 노드ID, Prio: double/float 등
+// std::priority_queue와 같은 push_heap/pop_heap 순서, 벡터를 직접 들고 있어 clear()가 용량을 유지한다.
 template <class KeyT=int, class PrioT=double>
 class BinaryHeap final : public IPriorityQueue<KeyT,PrioT> {
 public:
   void push(const KeyT& k, PrioT p) override {
-    pq_.emplace(p, k);
+    pq_.emplace_back(p, k);
+    std::push_heap(pq_.begin(), pq_.end(), Cmp{});
     ++pushes_;
+    if (pq_.size() > peak_) peak_ = pq_.size();
   }
   std::optional<KeyT> pop() override {
     if (pq_.empty()) return std::nullopt;
-    auto [p,k] = pq_.top(); pq_.pop();
+    std::pop_heap(pq_.begin(), pq_.end(), Cmp{});
+    const KeyT k = pq_.back().second;
+    pq_.pop_back();
     ++pops_;
     return k;
   }
   bool empty() const override { return pq_.empty(); }
   size_t size() const override { return pq_.size(); }
+  void clear() override { pq_.clear(); pushes_ = pops_ = 0; peak_ = 0; }
 
   uint64_t push_count() const override { return pushes_; }
   uint64_t pop_count() const override { return pops_; }
-  void reset_stats() override { pushes_=0; pops_=0; }
+  void reset_stats() override { pushes_=0; pops_=0; peak_=pq_.size(); }
+  size_t peak_size() const override { return peak_; } // lazy 중복 항목 포함
 
 private:
   using Item = std::pair<PrioT,KeyT>;
   struct Cmp { bool operator()(const Item&a,const Item&b) const { return a.first > b.first; } };
-  std::priority_queue<Item,std::vector<Item>,Cmp> pq_;
+  std::vector<Item> pq_;   // Cmp 기준 힙 (top = 최소 우선순위)
 
   uint64_t pushes_{0}, pops_{0};
+  size_t peak_{0};
 };
 
 
@@ -0,0 +1,133 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include "pathlab/queues/ipriority_queue.hpp"
+
+namespace pathlab {
+
+// Indexed D-ary Heap (기본 4-ary) with true decrease-key
+// - key(노드ID, 0 이상 정수)별 위치 맵으로 힙 안에 key당 항목 하나만 유지.
+// - push(k,p): 없으면 삽입, 있으면 p가 더 작을 때만 decrease-key (중복 항목 없음).
+// - 따라서 pops == 실제 확장 수, size()는 open list 크기와 같다.
+// - 위치 맵은 등장한 최대 key까지 필요할 때 늘린다 (reserve(n)으로 미리 확보 가능).
+template <class KeyT=int, class PrioT=double, unsigned D=4>
+class IndexedDaryHeap final : public IPriorityQueue<KeyT,PrioT> {
+  static_assert(D >= 2, "D must be >= 2");
+public:
+  void reserve(size_t n_keys) {
+    if (pos_.size() < n_keys) pos_.resize(n_keys, NPOS);
+  }
+
+  void push(const KeyT& k, PrioT p) override {
+    ++pushes_;
+    const size_t ki = static_cast<size_t>(k);
+    if (ki >= pos_.size()) pos_.resize(ki + 1 > 2*pos_.size() ? ki + 1 : 2*pos_.size(), NPOS);
+    const uint32_t at = pos_[ki];
+    if (at == NPOS) {
+      heap_.push_back({p, k});
+      pos_[ki] = static_cast<uint32_t>(heap_.size() - 1);
+      sift_up(heap_.size() - 1);
+      if (heap_.size() > peak_) peak_ = heap_.size();
+    } else if (p < heap_[at].first) {
+      ++decreases_;
+      heap_[at].first = p;
+      sift_up(at);
+    }
+  }
+
+  // 명시적 decrease-key (key가 힙에 있고 p가 더 작을 때만 반영)
+  bool decrease_key(const KeyT& k, PrioT p) {
+    if (!contains(k)) return false;
+    const uint32_t at = pos_[static_cast<size_t>(k)];
+    if (!(p < heap_[at].first)) return false;
+    ++decreases_;
+    heap_[at].first = p;
+    sift_up(at);
+    return true;
+  }
+
+  bool contains(const KeyT& k) const {
+    const size_t ki = static_cast<size_t>(k);
+    return ki < pos_.size() && pos_[ki] != NPOS;
+  }
+
+  std::optional<KeyT> pop() override {
+    if (heap_.empty()) return std::nullopt;
+    const KeyT top = heap_[0].second;
+    pos_[static_cast<size_t>(top)] = NPOS;
+    if (heap_.size() > 1) {
+      heap_[0] = heap_.back();
+      pos_[static_cast<size_t>(heap_[0].second)] = 0;
+      heap_.pop_back();
+      sift_down(0);
+    } else {
+      heap_.pop_back();
+    }
+    ++pops_;
+    return top;
+  }
+
+  // 남은 항목의 위치만 지운다 (pop된 key는 이미 NPOS) → 쿼리 간 재사용 시 O(남은 open 크기)
+  void clear() override {
+    for (auto& e : heap_) pos_[static_cast<size_t>(e.second)] = NPOS;
+    heap_.clear();
+    pushes_ = pops_ = decreases_ = 0;
+    peak_ = 0;
+  }
+
+  bool empty() const override { return heap_.empty(); }
+  size_t size() const override { return heap_.size(); }
+
+  uint64_t push_count() const override { return pushes_; }
+  uint64_t pop_count() const override { return pops_; }
+  void reset_stats() override { pushes_ = pops_ = decreases_ = 0; peak_ = heap_.size(); }
+  size_t peak_size() const override { return peak_; }
+  uint64_t decrease_count() const { return decreases_; }
+
+private:
+  using Item = std::pair<PrioT,KeyT>;
+  static constexpr uint32_t NPOS = UINT32_MAX;
+
+  void place(size_t i, const Item& it) {
+    heap_[i] = it;
+    pos_[static_cast<size_t>(it.second)] = static_cast<uint32_t>(i);
+  }
+
+  void sift_up(size_t i) {
+    const Item it = heap_[i];
+    while (i > 0) {
+      const size_t parent = (i - 1) / D;
+      if (!(it.first < heap_[parent].first)) break;
+      place(i, heap_[parent]);
+      i = parent;
+    }
+    place(i, it);
+  }
+
+  void sift_down(size_t i) {
+    const Item it = heap_[i];
+    const size_t n = heap_.size();
+    for (;;) {
+      const size_t first = i * D + 1;
+      if (first >= n) break;
+      const size_t last = first + D < n ? first + D : n;
+      size_t best = first;
+      for (size_t c = first + 1; c < last; ++c)
+        if (heap_[c].first < heap_[best].first) best = c;
+      if (!(heap_[best].first < it.first)) break;
+      place(i, heap_[best]);
+      i = best;
+    }
+    place(i, it);
+  }
+
+  std::vector<Item> heap_;
+  std::vector<uint32_t> pos_;  // key → 힙 인덱스 (NPOS = 없음)
+
+  uint64_t pushes_{0}, pops_{0}, decreases_{0};
+  size_t peak_{0};
+};
+
+} // namespace pathlab
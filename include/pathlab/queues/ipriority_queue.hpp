@@ -10,9 +10,11 @@ struct IPriorityQueue {
   virtual std::optional<KeyT> pop() = 0;   // 최소 우선순위 key 반환
   virtual bool empty() const = 0;
   virtual size_t size() const = 0;
+  virtual void clear() = 0;                // 비우고 통계 초기화 (버퍼 용량은 유지, 쿼리 간 재사용)
 
   virtual uint64_t push_count() const = 0;
   virtual uint64_t pop_count() const = 0;
+  virtual size_t peak_size() const = 0;    // 관측된 최대 size()
   virtual void reset_stats() = 0;
 };
 
@@ -20,7 +20,7 @@ class POQueue final : public IPriorityQueue<KeyT,double> {
 public:
   POQueue(){ clear(); }
 
-  void clear() {
+  void clear() override {
     for (auto &b: buckets_) b.clear();
     future_.clear();
     base_ = 0;
@@ -40,6 +40,8 @@ public:
       const uint64_t offset = key - base_;
       const uint32_t idx = static_cast<uint32_t>(offset / GRAIN);
       buckets_[idx].emplace_back(key, k);
+      // 이미 지나간 버킷에 들어오면(A*의 동일 f 등) 커서를 되돌려야 누락되지 않음
+      if (idx < cursor_) cursor_ = idx;
     } else {
       future_.emplace_back(key, k);
       if (key < min_future_) min_future_ = key;
@@ -77,7 +79,7 @@ public:
   uint64_t push_count() const override { return pushes_; }
   uint64_t pop_count()  const override { return pops_;  }
   void reset_stats()    override { pushes_ = pops_ = 0; peak_ = sz_; }
-  size_t peak_size()    const { return peak_; }
+  size_t peak_size()    const override { return peak_; }
   size_t current_size() const { return sz_; }
 
 private:
@@ -0,0 +1,92 @@
+#pragma once
+#include <vector>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <bit>
+#include "pathlab/queues/ipriority_queue.hpp"
+
+namespace pathlab {
+
+// Monotone Radix Heap (옥타일 격자 비용 특화)
+// - 키(거리) 단조 비감소 pop 가정(Dijkstra/일관 휴리스틱 A*).
+// - 음이 아닌 double은 비트 패턴(uint64) 순서 = 값 순서 → 양자화 없이 정확한 키 비교.
+// - 버킷 i(>0): 마지막 pop 키(last)와 처음 다른 비트가 i-1번째인 원소들. 버킷 0 = last와 동일 키.
+// - 격자 비용은 a + b·√2 이고 간선 가중치 ≤ √2 이므로, 프런티어 키는 [last, last+√2+h변화]에
+//   몰려 지수부/상위 가수부 비트를 공유한다 → 원소가 거치는 버킷 수가 작아 push/pop이 상각 O(1).
+template <class KeyT=int>
+class RadixHeap final : public IPriorityQueue<KeyT,double> {
+public:
+  RadixHeap(){ clear(); }
+
+  void clear() override {
+    for (auto &b: buckets_) b.clear();
+    last_ = 0;
+    sz_ = 0;
+    pushes_ = pops_ = 0;
+    peak_ = 0;
+  }
+
+  // --- IPriorityQueue ---
+  void push(const KeyT& k, double prio) override {
+    uint64_t key = to_bits(prio);
+    if (key < last_) key = last_; // 단조 위반 안전망 (부동소수 반올림 1ulp 등)
+    buckets_[bucket_of(key)].emplace_back(key, k);
+    ++sz_; ++pushes_;
+    if (sz_ > peak_) peak_ = sz_;
+  }
+
+  std::optional<KeyT> pop() override {
+    if (sz_ == 0) return std::nullopt;
+    if (buckets_[0].empty()) redistribute();
+
+    auto &b = buckets_[0];
+    auto kv = b.back(); b.pop_back();
+    --sz_; ++pops_;
+    return kv.second;
+  }
+
+  bool empty() const override { return sz_ == 0; }
+  size_t size()  const override { return sz_; }
+
+  // --- stats ---
+  uint64_t push_count() const override { return pushes_; }
+  uint64_t pop_count()  const override { return pops_;  }
+  void reset_stats()    override { pushes_ = pops_ = 0; peak_ = sz_; }
+  size_t peak_size()    const override { return peak_; }
+
+private:
+  using Pair = std::pair<uint64_t, KeyT>; // (bit_key, id)
+  static constexpr int NB = 65;           // 버킷 0 + 비트 위치 64개
+
+  std::vector<Pair> buckets_[NB];
+  uint64_t last_{0};
+  size_t   sz_{0};
+  uint64_t pushes_{0}, pops_{0};
+  size_t   peak_{0};
+
+  static inline uint64_t to_bits(double prio) {
+    if (!(prio > 0)) return 0;                // 0, 음수, NaN → 0
+    return std::bit_cast<uint64_t>(prio);     // +inf도 순서 보존
+  }
+
+  inline int bucket_of(uint64_t key) const {
+    return key == last_ ? 0 : 64 - std::countl_zero(key ^ last_);
+  }
+
+  // 버킷 0이 비었을 때: 첫 non-empty 버킷의 최소 키를 새 last로 삼고 하위 버킷으로 재분배
+  void redistribute() {
+    int i = 1;
+    while (buckets_[i].empty()) ++i;
+
+    auto &src = buckets_[i];
+    uint64_t mn = src[0].first;
+    for (auto &kv : src) if (kv.first < mn) mn = kv.first;
+    last_ = mn;
+
+    for (auto &kv : src) buckets_[bucket_of(kv.first)].push_back(kv); // 항상 < i 로 이동
+    src.clear();
+  }
+};
+
+} // namespace pathlab
@@ -1,23 +1,44 @@
 #pragma once
+#include <concepts>
 #include <cstdint>
 #include <functional>
 #include <string>
 
 namespace pathlab {
 
+class LandmarkTable;
+
 enum class HeuType : uint8_t {
     Zero,
     Manhattan,
     Euclidean,
-    Octile
+    Octile,
+    Alt,        // 랜드마크(ALT) 테이블 + 기하 하한 (Heuristic::landmarks 필요)
+    Custom      // 임의 std::function (정책 타입 없음)
 };
 
 struct Heuristic {
     std::function<double(int,int,int,int)> h; // h(x1,y1,x2,y2)
     std::string name;
+    HeuType type{HeuType::Custom};            // 정책 타입 디스패치용
+    const LandmarkTable* landmarks{nullptr};  // HeuType::Alt 전용 (소유하지 않음)
 };
 
+// 휴리스틱 정책: h(x1,y1,x2,y2)를 값으로 들고 다니는 functor (솔버 템플릿 인자)
+template <class HP>
+concept HeuristicPolicy = std::is_invocable_r_v<double, const HP&, int, int, int, int>;
+
 // base에는 zero만 둡니다 (중복 방지)
 inline double h_zero(int,int,int,int){ return 0.0; }
 
+struct ZeroH {
+    double operator()(int,int,int,int) const { return 0.0; }
+};
+
+// 등록되지 않은 함수용 폴백 (간접 호출 유지)
+struct FunctionH {
+    const std::function<double(int,int,int,int)>* fn;
+    double operator()(int x1,int y1,int x2,int y2) const { return (*fn)(x1,y1,x2,y2); }
+};
+
 } // namespace pathlab
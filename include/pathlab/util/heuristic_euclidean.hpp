@@ -9,4 +9,8 @@ inline double h_euclidean(int x1,int y1,int x2,int y2){
     return std::sqrt(double(dx*dx + dy*dy));
 }
 
+struct EuclideanH {
+    double operator()(int x1,int y1,int x2,int y2) const { return h_euclidean(x1,y1,x2,y2); }
+};
+
 } // namespace pathlab
@@ -8,18 +8,29 @@
 
 namespace pathlab {
 
+// 컴파일 타임 레지스트리: HeuType → 구체 정책 functor (상태 없는 정책만, Alt는 테이블 포인터를 들고 있어 별도)
+template <HeuType T> struct HeuristicFor;
+template <> struct HeuristicFor<HeuType::Zero>      { using type = ZeroH;      };
+template <> struct HeuristicFor<HeuType::Manhattan> { using type = ManhattanH; };
+template <> struct HeuristicFor<HeuType::Euclidean> { using type = EuclideanH; };
+template <> struct HeuristicFor<HeuType::Octile>    { using type = OctileH;    };
+
+template <HeuType T>
+using heuristic_for_t = typename HeuristicFor<T>::type;
+
 // 열거→Heuristic
 inline Heuristic make_heuristic(HeuType t){
     switch(t){
-        case HeuType::Zero:      return { h_zero,      "zero"      };
-        case HeuType::Manhattan: return { h_manhattan, "manhattan" };
-        case HeuType::Euclidean: return { h_euclidean, "euclidean" };
-        case HeuType::Octile:    return { h_octile,    "octile"    };
-        default:                 return { h_zero,      "zero"      };
+        case HeuType::Zero:      return { h_zero,      "zero",      HeuType::Zero      };
+        case HeuType::Manhattan: return { h_manhattan, "manhattan", HeuType::Manhattan };
+        case HeuType::Euclidean: return { h_euclidean, "euclidean", HeuType::Euclidean };
+        case HeuType::Octile:    return { h_octile,    "octile",    HeuType::Octile    };
+        default:                 return { h_zero,      "zero",      HeuType::Zero      };
     }
 }
 
 // 문자열→Heuristic (allow_diagonal에 따라 auto 선택)
+// "alt"는 랜드마크 테이블이 필요하므로 여기서는 auto로 대체 (algorithms/heuristic_dispatch.hpp의 오버로드 사용)
 inline Heuristic make_heuristic(const std::string& name, bool allow_diagonal){
     std::string s = name;
     std::transform(s.begin(), s.end(), s.begin(), ::tolower);
@@ -8,4 +8,8 @@ inline double h_manhattan(int x1,int y1,int x2,int y2){
     return std::abs(x1-x2) + std::abs(y1-y2);
 }
 
+struct ManhattanH {
+    double operator()(int x1,int y1,int x2,int y2) const { return h_manhattan(x1,y1,x2,y2); }
+};
+
 } // namespace pathlab
@@ -1,16 +1,21 @@
 #pragma once
 #include <algorithm>
 #include <cmath>
+#include <cstdlib>
 #include "pathlab/util/heuristic_base.hpp"
 
 namespace pathlab {
 
 // 8방 격자: 직교=1, 대각=√2
 inline double h_octile(int x1,int y1,int x2,int y2){
+    constexpr double SQRT2 = 1.41421356237309504880; // std::sqrt(2.0)와 동일 값, 호출마다 계산 X
     int dx = std::abs(x1-x2), dy = std::abs(y1-y2);
-    const double SQRT2 = std::sqrt(2.0);
     int m = std::min(dx, dy);
     return (dx + dy) + (SQRT2 - 2.0) * m;
 }
 
+struct OctileH {
+    double operator()(int x1,int y1,int x2,int y2) const { return h_octile(x1,y1,x2,y2); }
+};
+
 } // namespace pathlab
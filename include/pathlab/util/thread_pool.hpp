@@ -0,0 +1,123 @@
+#pragma once
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace pathlab {
+
+// 작업 훔치기(work-stealing) 스레드 풀
+// - parallel_for(n, grain, f): [0,n)을 grain 크기 청크로 나눠 워커별 덱에 연속 배분.
+// - 워커는 자기 덱의 뒤에서 꺼내고, 비면 다른 워커 덱의 앞에서 훔친다.
+// - f(worker_id, i): worker_id ∈ [0, size()) → 워커별 솔버/작업공간 인덱스로 사용.
+// - 호출 스레드가 worker 0으로 참여하므로 size()==1이면 추가 스레드 없음.
+class ThreadPool {
+public:
+  explicit ThreadPool(unsigned n_threads)
+  : n_(n_threads ? n_threads : 1), queues_(n_) {
+    for (unsigned w = 1; w < n_; ++w) threads_.emplace_back([this, w]{ worker_loop(w); });
+  }
+
+  ~ThreadPool() {
+    { std::lock_guard<std::mutex> lk(m_); stop_ = true; }
+    cv_.notify_all();
+    for (auto& t : threads_) t.join();
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  unsigned size() const { return n_; }
+
+  template <class F>
+  void parallel_for(size_t n, size_t grain, F&& f) {
+    if (n == 0) return;
+    grain = std::max<size_t>(grain, 1);
+    const size_t chunks = (n + grain - 1) / grain;
+
+    {
+      std::lock_guard<std::mutex> lk(m_);
+      body_ = [&f, n, grain](unsigned w, size_t c) {
+        const size_t b = c * grain, e = std::min(n, b + grain);
+        for (size_t i = b; i < e; ++i) f(w, i);
+      };
+      // 워커별로 연속 구간을 나눠 담는다 (지역성 유지, 불균형은 훔치기로 해소)
+      for (unsigned w = 0; w < n_; ++w) {
+        std::lock_guard<std::mutex> qlk(queues_[w].m);
+        queues_[w].chunks.clear();
+        const size_t b = chunks * w / n_, e = chunks * (w + 1) / n_;
+        for (size_t c = b; c < e; ++c) queues_[w].chunks.push_back(c);
+      }
+      done_workers_ = 0;
+      ++generation_;
+    }
+    cv_.notify_all();
+
+    run_chunks(0);
+
+    std::unique_lock<std::mutex> lk(m_);
+    done_cv_.wait(lk, [&]{ return done_workers_ == n_ - 1; });
+    body_ = nullptr;
+  }
+
+private:
+  struct WorkQueue {
+    std::mutex m;
+    std::deque<size_t> chunks;
+  };
+
+  void worker_loop(unsigned w) {
+    uint64_t seen = 0;
+    for (;;) {
+      {
+        std::unique_lock<std::mutex> lk(m_);
+        cv_.wait(lk, [&]{ return stop_ || generation_ != seen; });
+        if (stop_) return;
+        seen = generation_;
+      }
+      run_chunks(w);
+      {
+        std::lock_guard<std::mutex> lk(m_);
+        ++done_workers_;
+      }
+      done_cv_.notify_one();
+    }
+  }
+
+  void run_chunks(unsigned w) {
+    size_t c;
+    while (take(w, c)) body_(w, c);
+  }
+
+  bool take(unsigned w, size_t& c) {
+    {
+      auto& q = queues_[w];
+      std::lock_guard<std::mutex> lk(q.m);
+      if (!q.chunks.empty()) { c = q.chunks.back(); q.chunks.pop_back(); return true; }
+    }
+    for (unsigned k = 1; k < n_; ++k) {
+      auto& q = queues_[(w + k) % n_];
+      std::lock_guard<std::mutex> lk(q.m);
+      if (!q.chunks.empty()) { c = q.chunks.front(); q.chunks.pop_front(); return true; }
+    }
+    return false;
+  }
+
+  unsigned n_;
+  std::vector<WorkQueue> queues_;
+  std::vector<std::thread> threads_;
+
+  std::mutex m_;
+  std::condition_variable cv_, done_cv_;
+  std::function<void(unsigned, size_t)> body_;
+  uint64_t generation_{0};
+  unsigned done_workers_{0};
+  bool stop_{false};
+};
+
+} // namespace pathlab
@@ -0,0 +1,264 @@
+// src/core/contraction_hierarchy.cpp
+#include "pathlab/core/contraction_hierarchy.hpp"
+#include "pathlab/algorithms/search_context.hpp"
+#include "pathlab/queues/binary_heap.hpp"
+#include "pathlab/util/thread_pool.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace pathlab {
+
+namespace {
+    const char     kMagic[4] = { 'P', 'L', 'C', 'H' };
+    const uint32_t kVersion  = 1;
+
+    using DArc = ContractionHierarchy::Arc;   // 축약 중 남은 그래프의 간선
+    struct Shortcut { uint32_t u, w, mid; double d; };
+
+    // 동률 경로도 witness로 인정 (a + b√2 합의 반올림 차이 흡수)
+    inline bool covers(double witness, double need) { return witness <= need * (1.0 + 1e-12); }
+
+    // v를 축약하면 필요한 shortcut (이웃 쌍 i<j마다 한 번). skip(x)인 노드는 witness 경로에서 제외.
+    // out이 nullptr이면 개수만 센다 (우선순위 계산).
+    template <class Skip>
+    size_t simulate(const std::vector<std::vector<DArc>>& adj, uint32_t v, Skip&& skip,
+                    SearchContext& ctx, std::vector<Shortcut>* out) {
+        const std::vector<DArc>& nb = adj[v];
+        size_t count = 0;
+        for (size_t i = 0; i + 1 < nb.size(); ++i) {
+            const uint32_t u = nb[i].to;
+            double max_w = 0.0;
+            for (size_t j = i + 1; j < nb.size(); ++j) max_w = std::max(max_w, nb[j].w);
+            const double limit = nb[i].w + max_w;
+
+            // u에서 제한된 Dijkstra (v와 skip 노드 제외)
+            ctx.begin(adj.size());
+            BinaryHeap<int,double> open;
+            ctx.set((int)u, 0.0, -1);
+            open.push((int)u, 0.0);
+            int settled = 0;
+            while (!open.empty()) {
+                const int x = *open.pop();
+                if (ctx.closed(x)) continue;
+                ctx.close(x);
+                const double dx = ctx.g(x);
+                if (dx > limit || ++settled > ContractionHierarchy::kWitnessSettle) break;
+                for (const DArc& a : adj[x]) {
+                    if (a.to == v || skip(a.to) || ctx.closed((int)a.to)) continue;
+                    const double nd = dx + a.w;
+                    if (nd <= limit && nd < ctx.g((int)a.to)) { ctx.set((int)a.to, nd, x); open.push((int)a.to, nd); }
+                }
+            }
+            for (size_t j = i + 1; j < nb.size(); ++j) {
+                const double need = nb[i].w + nb[j].w;
+                if (covers(ctx.g((int)nb[j].to), need)) continue;
+                ++count;
+                if (out) out->push_back(Shortcut{ u, nb[j].to, v, need });
+            }
+        }
+        return count;
+    }
+
+    // u–w 간선을 d로 추가하거나 더 짧으면 갱신
+    void upsert(std::vector<DArc>& list, uint32_t w, uint32_t mid, double d) {
+        for (DArc& a : list)
+            if (a.to == w) { if (d < a.w) { a.w = d; a.mid = mid; } return; }
+        list.push_back(DArc{ w, mid, d });
+    }
+}
+
+void ContractionHierarchy::build(const CsrGraph& g, unsigned threads) {
+    const uint32_t n = g.node_count();
+    fingerprint_ = g.fingerprint();
+    shortcuts_ = 0;
+
+    // 남은 그래프 (중복 간선은 최소 가중치 하나로)
+    std::vector<std::vector<DArc>> adj(n);
+    for (uint32_t v = 0; v < n; ++v)
+        for (uint64_t e = g.edges_begin(v); e < g.edges_end(v); ++e)
+            if (g.target(e) != v) upsert(adj[v], g.target(e), kNoMid, g.weight(e));
+
+    ThreadPool pool(std::max(1u, threads));
+    std::vector<SearchContext> ctxs(pool.size());
+    std::vector<int32_t> deleted(n, 0);     // 이미 축약된 이웃 수
+    std::vector<int64_t> prio(n, 0);
+    std::vector<uint8_t> contracted(n, 0), in_batch(n, 0);
+    auto priority = [&](uint32_t v, SearchContext& ctx) {
+        const size_t sc = simulate(adj, v, [](uint32_t) { return false; }, ctx, nullptr);
+        return (int64_t)sc - (int64_t)adj[v].size() + deleted[v];
+    };
+    auto before = [&](uint32_t a, uint32_t b) { return prio[a] != prio[b] ? prio[a] < prio[b] : a < b; };
+
+    pool.parallel_for(n, /*grain=*/256, [&](unsigned w, size_t v) { prio[v] = priority((uint32_t)v, ctxs[w]); });
+
+    std::vector<uint32_t> remaining(n);
+    for (uint32_t v = 0; v < n; ++v) remaining[v] = v;
+    rank_.assign(n, 0);
+    std::vector<std::vector<DArc>> up(n);
+    std::vector<std::vector<Shortcut>> found;
+    std::vector<uint32_t> batch, touched;
+    uint32_t next_rank = 0;
+
+    while (!remaining.empty()) {
+        // 1-hop 이웃 중 우선순위 최소인 노드들 (독립 집합)
+        batch.clear();
+        for (uint32_t v : remaining) {
+            bool local_min = true;
+            for (const DArc& a : adj[v]) if (before(a.to, v)) { local_min = false; break; }
+            if (local_min) batch.push_back(v);
+        }
+        for (uint32_t v : batch) in_batch[v] = 1;
+
+        // shortcut 계산 (읽기 전용, 병렬). witness는 이번 묶음 노드를 지나지 않는다.
+        found.assign(batch.size(), {});
+        pool.parallel_for(batch.size(), /*grain=*/4, [&](unsigned w, size_t i) {
+            simulate(adj, batch[i], [&](uint32_t x) { return in_batch[x] != 0; }, ctxs[w], &found[i]);
+        });
+
+        // 적용 (직렬): 상향 간선 기록 → 이웃에서 제거 → shortcut 추가
+        touched.clear();
+        for (size_t i = 0; i < batch.size(); ++i) {
+            const uint32_t v = batch[i];
+            rank_[v] = next_rank++;
+            contracted[v] = 1;
+            up[v] = std::move(adj[v]);
+            for (const DArc& a : up[v]) {
+                auto& l = adj[a.to];
+                l.erase(std::remove_if(l.begin(), l.end(), [v](const DArc& b) { return b.to == v; }), l.end());
+                ++deleted[a.to];
+                touched.push_back(a.to);
+            }
+            for (const Shortcut& s : found[i]) {
+                upsert(adj[s.u], s.w, s.mid, s.d);
+                upsert(adj[s.w], s.u, s.mid, s.d);
+            }
+            shortcuts_ += found[i].size();
+            std::vector<DArc>().swap(adj[v]);
+        }
+        for (uint32_t v : batch) in_batch[v] = 0;
+
+        // 이웃 우선순위 갱신 (병렬)
+        std::sort(touched.begin(), touched.end());
+        touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+        pool.parallel_for(touched.size(), /*grain=*/16, [&](unsigned w, size_t i) {
+            prio[touched[i]] = priority(touched[i], ctxs[w]);
+        });
+        remaining.erase(std::remove_if(remaining.begin(), remaining.end(),
+                                       [&](uint32_t v) { return contracted[v] != 0; }),
+                        remaining.end());
+    }
+
+    up_off_.assign((size_t)n + 1, 0);
+    for (uint32_t v = 0; v < n; ++v) up_off_[v + 1] = up_off_[v] + up[v].size();
+    up_.clear();
+    up_.reserve(up_off_[n]);
+    for (auto& l : up) { up_.insert(up_.end(), l.begin(), l.end()); std::vector<DArc>().swap(l); }
+}
+
+const ContractionHierarchy::Arc* ContractionHierarchy::find_up(uint32_t lo, uint32_t hi) const {
+    for (const Arc* a = up_begin(lo); a != up_end(lo); ++a) if (a->to == hi) return a;
+    return nullptr;
+}
+
+void ContractionHierarchy::unpack(uint32_t u, uint32_t v, uint32_t mid, std::vector<uint32_t>& out,
+                                  double& cost) const {
+    if (mid == kNoMid) {
+        // 원래 간선: 가중치는 낮은 순위 쪽 상향 간선에 있다
+        const Arc* a = rank_[u] < rank_[v] ? find_up(u, v) : find_up(v, u);
+        cost += a->w;
+        out.push_back(v);
+        return;
+    }
+    // mid는 u, v보다 먼저 축약됨 → mid의 상향 간선에 u, v가 있다
+    unpack(u, mid, find_up(mid, u)->mid, out, cost);
+    unpack(mid, v, find_up(mid, v)->mid, out, cost);
+}
+
+bool ContractionHierarchy::save(const std::string& filepath) const {
+    std::ofstream out(filepath, std::ios::binary);
+    if (!out.is_open()) return false;
+    const uint64_t n = rank_.size(), m = up_.size(), sc = shortcuts_;
+    std::vector<uint32_t> to(m), mid(m);
+    std::vector<double> w(m);
+    for (size_t i = 0; i < m; ++i) { to[i] = up_[i].to; mid[i] = up_[i].mid; w[i] = up_[i].w; }
+    out.write(kMagic, 4);
+    out.write(reinterpret_cast<const char*>(&kVersion), sizeof(kVersion));
+    out.write(reinterpret_cast<const char*>(&fingerprint_), sizeof(fingerprint_));
+    out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    out.write(reinterpret_cast<const char*>(&m), sizeof(m));
+    out.write(reinterpret_cast<const char*>(&sc), sizeof(sc));
+    out.write(reinterpret_cast<const char*>(rank_.data()), (std::streamsize)(n * sizeof(uint32_t)));
+    out.write(reinterpret_cast<const char*>(up_off_.data()), (std::streamsize)((n + 1) * sizeof(uint64_t)));
+    out.write(reinterpret_cast<const char*>(to.data()), (std::streamsize)(m * sizeof(uint32_t)));
+    out.write(reinterpret_cast<const char*>(mid.data()), (std::streamsize)(m * sizeof(uint32_t)));
+    out.write(reinterpret_cast<const char*>(w.data()), (std::streamsize)(m * sizeof(double)));
+    return (bool)out;
+}
+
+bool ContractionHierarchy::load(const std::string& filepath, const CsrGraph& g) {
+    std::ifstream in(filepath, std::ios::binary);
+    if (!in.is_open()) return false;
+
+    char magic[4];
+    uint32_t version = 0;
+    uint64_t fp = 0, n = 0, m = 0, sc = 0;
+    in.read(magic, 4);
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    in.read(reinterpret_cast<char*>(&fp), sizeof(fp));
+    in.read(reinterpret_cast<char*>(&n), sizeof(n));
+    in.read(reinterpret_cast<char*>(&m), sizeof(m));
+    in.read(reinterpret_cast<char*>(&sc), sizeof(sc));
+    if (!in || std::memcmp(magic, kMagic, 4) != 0 || version != kVersion) return false;
+    if (n != g.node_count() || fp != g.fingerprint()) return false; // 다른 그래프
+
+    std::vector<uint32_t> rank(n), to(m), mid(m);
+    std::vector<uint64_t> off(n + 1);
+    std::vector<double> w(m);
+    in.read(reinterpret_cast<char*>(rank.data()), (std::streamsize)(n * sizeof(uint32_t)));
+    in.read(reinterpret_cast<char*>(off.data()), (std::streamsize)((n + 1) * sizeof(uint64_t)));
+    in.read(reinterpret_cast<char*>(to.data()), (std::streamsize)(m * sizeof(uint32_t)));
+    in.read(reinterpret_cast<char*>(mid.data()), (std::streamsize)(m * sizeof(uint32_t)));
+    in.read(reinterpret_cast<char*>(w.data()), (std::streamsize)(m * sizeof(double)));
+    if (!in || off[0] != 0 || off.back() != m) return false;
+    for (size_t i = 0; i < m; ++i)
+        if (to[i] >= n || (mid[i] != kNoMid && mid[i] >= n)) return false;
+
+    // 손상된 파일은 unpack/질의에서 잘못된 포인터로 이어지므로 구조를 모두 검사하고 재생성에 맡긴다
+    // - 오프셋 비감소, rank는 [0,n) 순열, 상향 간선은 더 높은 순위로만
+    // - 지름길의 mid는 양 끝보다 낮은 순위이고 mid의 상향 간선에 양 끝이 있다 (unpack의 find_up이 성공)
+    std::vector<char> used(n, 0);
+    for (uint64_t v = 0; v < n; ++v) {
+        if (off[v] > off[v + 1] || rank[v] >= n || used[rank[v]]) return false;
+        used[rank[v]] = 1;
+    }
+    auto has_up = [&](uint32_t lo, uint32_t hi) {
+        for (uint64_t e = off[lo]; e < off[lo + 1]; ++e) if (to[e] == hi) return true;
+        return false;
+    };
+    for (uint64_t u = 0; u < n; ++u)
+        for (uint64_t e = off[u]; e < off[u + 1]; ++e) {
+            if (rank[to[e]] <= rank[u]) return false;
+            const uint32_t x = mid[e];
+            if (x == kNoMid) continue;
+            if (rank[x] >= rank[u] || !has_up(x, (uint32_t)u) || !has_up(x, to[e])) return false;
+        }
+
+    fingerprint_ = fp;
+    shortcuts_ = (size_t)sc;
+    rank_.swap(rank);
+    up_off_.swap(off);
+    up_.resize(m);
+    for (size_t i = 0; i < m; ++i) up_[i] = Arc{ to[i], mid[i], w[i] };
+    return true;
+}
+
+bool ContractionHierarchy::load_or_build(const std::string& map_path, const CsrGraph& g, unsigned threads) {
+    const std::string path = default_path(map_path);
+    if (load(path, g)) return true;
+    build(g, threads);
+    save(path); // 저장 실패(읽기 전용 등)는 치명적이지 않음
+    return false;
+}
+
+} // namespace pathlab
@@ -0,0 +1,168 @@
+// src/core/csr_graph.cpp
+#include "pathlab/core/csr_graph.hpp"
+#include "pathlab/core/graph.hpp"
+#include "pathlab/io/mapped_file.hpp"
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <utility>
+
+namespace pathlab {
+
+namespace {
+    // Z-order: x, y 비트 교차 (x가 짝수 비트)
+    inline uint64_t spread_bits(uint32_t v) {
+        uint64_t x = v;
+        x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+        x = (x | (x << 8))  & 0x00FF00FF00FF00FFULL;
+        x = (x | (x << 4))  & 0x0F0F0F0F0F0F0F0FULL;
+        x = (x | (x << 2))  & 0x3333333333333333ULL;
+        x = (x | (x << 1))  & 0x5555555555555555ULL;
+        return x;
+    }
+    inline uint64_t morton_key(uint32_t x, uint32_t y) { return spread_bits(x) | (spread_bits(y) << 1); }
+
+    // side(2의 거듭제곱) 정사각형 위 Hilbert 곡선 순번
+    uint64_t hilbert_key(uint32_t side, uint32_t x, uint32_t y) {
+        uint64_t d = 0;
+        for (uint32_t s = side / 2; s > 0; s /= 2) {
+            const uint32_t rx = (x & s) ? 1u : 0u, ry = (y & s) ? 1u : 0u;
+            d += (uint64_t)s * s * ((3u * rx) ^ ry);
+            if (ry == 0) {              // 사분면 회전
+                if (rx == 1) { x = side - 1 - x; y = side - 1 - y; }
+                std::swap(x, y);
+            }
+        }
+        return d;
+    }
+}
+
+CsrGraph CsrGraph::from_grid(const GridMap& map, bool allow_diagonal, GridLayout layout) {
+    CsrGraph g;
+    const int W = map.width(), H = map.height();
+    g.grid_w_ = W; g.grid_h_ = H; g.diag_ = allow_diagonal;
+    for (int y = 0; y < H; ++y)
+        for (int x = 0; x < W; ++x)
+            if (map.is_free(x, y)) g.grid_id_.push_back(y * W + x);
+
+    // 번호 순서: 행 우선이면 그대로, 아니면 곡선 키로 정렬
+    if (layout != GridLayout::RowMajor) {
+        const uint32_t side = std::bit_ceil((uint32_t)std::max({ W, H, 1 }));
+        std::vector<std::pair<uint64_t, int32_t>> keyed;
+        keyed.reserve(g.grid_id_.size());
+        for (int32_t c : g.grid_id_) {
+            const uint32_t x = (uint32_t)(c % W), y = (uint32_t)(c / W);
+            keyed.emplace_back(layout == GridLayout::Morton ? morton_key(x, y) : hilbert_key(side, x, y), c);
+        }
+        std::sort(keyed.begin(), keyed.end());
+        for (size_t i = 0; i < keyed.size(); ++i) g.grid_id_[i] = keyed[i].second;
+    }
+    g.node_of_.assign((size_t)W * H, -1);
+    for (size_t v = 0; v < g.grid_id_.size(); ++v) g.node_of_[(size_t)g.grid_id_[v]] = (int32_t)v;
+
+    const unsigned DIRS = allow_diagonal ? 0xFFu : 0x0Fu;
+    const size_t n = g.grid_id_.size();
+    g.offsets_.assign(n + 1, 0);
+    for (size_t v = 0; v < n; ++v) {
+        const int x = g.grid_id_[v] % W, y = g.grid_id_[v] / W;
+        // 이웃 마스크 비트 순서(DIR_DX/DIR_DY) 그대로 → 격자 탐색과 같은 이웃 순서
+        for (unsigned m = map.neighbor_mask8(map.to_padded(x, y)) & DIRS; m; m &= m - 1) {
+            const int k = std::countr_zero(m);
+            g.targets_.push_back((uint32_t)g.node_of_[(size_t)(y + DIR_DY[k]) * W + (x + DIR_DX[k])]);
+            g.weights_.push_back(GridGraph::WC[k]);
+        }
+        g.offsets_[v + 1] = g.targets_.size();
+    }
+    return g;
+}
+
+namespace {
+    inline void skip_space(const char*& p, const char* e) { while (p < e && (*p == ' ' || *p == '\t')) ++p; }
+
+    template <class T>
+    inline bool next_number(const char*& p, const char* e, T& v) {
+        skip_space(p, e);
+        auto [q, ec] = std::from_chars(p, e, v);
+        if (ec != std::errc()) return false;
+        p = q;
+        return true;
+    }
+}
+
+bool CsrGraph::load_dimacs(const std::string& filepath) {
+    MappedFile mf;
+    if (!mf.open(filepath) || !mf.data()) return false;
+
+    uint64_t n = 0, m = 0;
+    bool have_header = false;
+    std::vector<uint32_t> src, dst;
+    std::vector<double> w;
+
+    const char* p = mf.data();
+    const char* end = p + mf.size();
+    while (p < end) {
+        const char* nl = static_cast<const char*>(std::memchr(p, '\n', (size_t)(end - p)));
+        const char* le = nl ? nl : end;
+        const char* q = p;
+        p = nl ? nl + 1 : end;
+        skip_space(q, le);
+        if (q == le) continue;
+
+        if (*q == 'p') {               // p sp <n> <m>
+            q += 1; skip_space(q, le);
+            if (le - q < 2 || q[0] != 's' || q[1] != 'p') return false;
+            q += 2;
+            if (!next_number(q, le, n) || !next_number(q, le, m) || n >= UINT32_MAX) return false;
+            src.reserve(m); dst.reserve(m); w.reserve(m);
+            have_header = true;
+        } else if (*q == 'a') {        // a <u> <v> <w>
+            uint64_t u = 0, v = 0;
+            double wt = 0.0;
+            ++q;
+            if (!have_header || !next_number(q, le, u) || !next_number(q, le, v) || !next_number(q, le, wt)) return false;
+            if (u < 1 || v < 1 || u > n || v > n || !(wt >= 0)) return false;
+            src.push_back((uint32_t)(u - 1)); dst.push_back((uint32_t)(v - 1)); w.push_back(wt);
+        }                              // 'c' 주석 등은 무시
+    }
+    if (!have_header) return false;
+
+    // 출발 노드별 counting sort (안정)
+    *this = CsrGraph{};
+    offsets_.assign(n + 1, 0);
+    for (uint32_t u : src) ++offsets_[u + 1];
+    for (uint64_t i = 0; i < n; ++i) offsets_[i + 1] += offsets_[i];
+    std::vector<uint64_t> pos(offsets_.begin(), offsets_.end() - 1);
+    targets_.resize(src.size());
+    weights_.resize(src.size());
+    for (size_t e = 0; e < src.size(); ++e) {
+        const uint64_t at = pos[src[e]]++;
+        targets_[at] = dst[e];
+        weights_[at] = w[e];
+    }
+    return true;
+}
+
+double CsrGraph::cross_line_fraction(size_t bytes_per_node) const {
+    const uint32_t n = node_count();
+    if (targets_.empty() || bytes_per_node == 0) return 0.0;
+    uint64_t cross = 0;
+    for (uint32_t u = 0; u < n; ++u)
+        for (uint64_t e = offsets_[u]; e < offsets_[u + 1]; ++e)
+            cross += (u * bytes_per_node) / 64 != (targets_[e] * bytes_per_node) / 64;
+    return (double)cross / (double)targets_.size();
+}
+
+uint64_t CsrGraph::fingerprint() const {
+    uint64_t h = 1469598103934665603ULL;
+    auto mix = [&](const void* p, size_t bytes) {
+        const unsigned char* b = static_cast<const unsigned char*>(p);
+        for (size_t i = 0; i < bytes; ++i) { h ^= b[i]; h *= 1099511628211ULL; }
+    };
+    mix(offsets_.data(), offsets_.size() * sizeof(uint64_t));
+    mix(targets_.data(), targets_.size() * sizeof(uint32_t));
+    mix(weights_.data(), weights_.size() * sizeof(double));
+    return h;
+}
+
+} // namespace pathlab
@@ -0,0 +1,222 @@
+// src/core/first_move_table.cpp
+#include "pathlab/core/first_move_table.hpp"
+#include "pathlab/algorithms/dijkstra.hpp"
+#include "pathlab/util/thread_pool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+
+namespace pathlab {
+
+namespace {
+    const char     kMagic[4] = { 'P', 'L', 'F', 'M' };
+    const uint32_t kVersion  = 1;
+
+    inline uint32_t pack(uint32_t start, int move) { return (start << 4) | (uint32_t)move; }
+    inline int      run_move(uint32_t r)  { return (int)(r & 0xFu); }
+    inline uint32_t run_start(uint32_t r) { return r >> 4; }
+
+    // 워커별 작업공간
+    struct Worker {
+        Dijkstra dij;
+        SearchContext ctx;
+        std::vector<int> order;      // 확정 순서 (패딩 ID)
+        std::vector<uint8_t> fm;     // 패딩 ID → 첫 이동
+    };
+}
+
+void FirstMoveTable::build(const GridMap& map, bool allow_diagonal, unsigned threads) {
+    const int W = map.width(), H = map.height();
+    const int PW = map.padded_width();
+    width_ = W; height_ = H; diag_ = allow_diagonal;
+    hash_ = map.occupancy_hash();
+
+    // free 칸 순번 (행 우선)
+    rank_.assign((size_t)W * H, -1);
+    std::vector<int> cell_of; // 순번 → 패딩 ID
+    for (int y = 0; y < H; ++y)
+        for (int x = 0; x < W; ++x)
+            if (map.is_free(x, y)) {
+                rank_[(size_t)y * W + x] = (int32_t)cell_of.size();
+                cell_of.push_back(map.to_padded(x, y));
+            }
+    const size_t F = cell_of.size();
+
+    int OFF[8];
+    for (int k = 0; k < 8; ++k) OFF[k] = DIR_DX[k] + DIR_DY[k] * PW;
+    auto dir_of = [&](int from, int to) {
+        for (int k = 0; k < 8; ++k) if (from + OFF[k] == to) return k;
+        return kNone;
+    };
+
+    std::vector<std::vector<uint32_t>> rows(F);
+    ThreadPool pool(std::max(1u, threads));
+    std::vector<Worker> workers(pool.size());
+    pool.parallel_for(F, /*grain=*/16, [&](unsigned w, size_t s) {
+        Worker& wk = workers[w];
+        const int sP = cell_of[s];
+        if (wk.fm.size() < (size_t)map.padded_size()) wk.fm.resize((size_t)map.padded_size());
+        wk.order.clear();
+        wk.dij.sweep(wk.ctx, map, sP, 0, 0, allow_diagonal, ZeroH{},
+                     [&](int u) { wk.order.push_back(u); return false; });
+
+        // 최단 경로 트리에서 첫 이동 전파 (부모가 먼저 확정됨)
+        wk.fm[sP] = kNone;
+        for (size_t i = 1; i < wk.order.size(); ++i) {
+            const int u = wk.order[i], p = wk.ctx.parent(u);
+            wk.fm[u] = p == sP ? (uint8_t)dir_of(p, u) : wk.fm[p];
+        }
+
+        // run-length: 출발 칸은 wildcard
+        std::vector<uint32_t>& row = rows[s];
+        int cur = -1;
+        for (size_t t = 0; t < F; ++t) {
+            if (t == s) continue;
+            const int tp = cell_of[t];
+            const int m = wk.ctx.g(tp) < SearchContext::INF ? wk.fm[tp] : kNone;
+            if (m != cur) { row.push_back(pack(row.empty() ? 0u : (uint32_t)t, m)); cur = m; }
+        }
+        if (row.empty()) row.push_back(pack(0, kNone)); // 칸이 하나뿐인 맵
+        row.shrink_to_fit();
+    });
+
+    row_off_.assign(F + 1, 0);
+    for (size_t s = 0; s < F; ++s) row_off_[s + 1] = row_off_[s] + rows[s].size();
+    runs_.clear();
+    runs_.reserve(row_off_[F]);
+    for (auto& r : rows) { runs_.insert(runs_.end(), r.begin(), r.end()); std::vector<uint32_t>().swap(r); }
+}
+
+int FirstMoveTable::move_from(int src_rank, int dst_rank) const {
+    const uint32_t* b = runs_.data() + row_off_[src_rank];
+    const uint32_t* e = runs_.data() + row_off_[src_rank + 1];
+    // dst 이하에서 시작하는 마지막 run
+    const uint32_t* it = std::upper_bound(b, e, pack((uint32_t)dst_rank, 0xF));
+    return run_move(*(it - 1));
+}
+
+int FirstMoveTable::first_move(int sx, int sy, int gx, int gy) const {
+    if (empty()) return -1;
+    if (sx<0||sy<0||gx<0||gy<0||sx>=width_||gx>=width_||sy>=height_||gy>=height_) return -1;
+    const int s = rank_[(size_t)sy * width_ + sx], t = rank_[(size_t)gy * width_ + gx];
+    if (s < 0 || t < 0 || s == t) return -1;
+    const int m = move_from(s, t);
+    return m == kNone ? -1 : m;
+}
+
+PathResult FirstMoveTable::path(int sx, int sy, int gx, int gy) const {
+    PathResult r;
+    if (empty()) return r;
+    if (sx<0||sy<0||gx<0||gy<0||sx>=width_||gx>=width_||sy>=height_||gy>=height_) return r;
+    const int s = rank_[(size_t)sy * width_ + sx], t = rank_[(size_t)gy * width_ + gx];
+    if (s < 0 || t < 0) return r;
+
+    auto t0 = std::chrono::steady_clock::now();
+    int x = sx, y = sy;
+    double cost = 0.0;
+    r.path.push_back(y * width_ + x);
+    // 최적 경로는 free 칸을 두 번 지나지 않으므로 칸 수가 상한
+    for (size_t steps = 0; (x != gx || y != gy) && steps < row_off_.size(); ++steps) {
+        const int m = move_from(rank_[(size_t)y * width_ + x], t);
+        if (m == kNone) { r.path.clear(); return r; }
+        x += DIR_DX[m]; y += DIR_DY[m];
+        cost += GridGraph::WC[m];
+        r.path.push_back(y * width_ + x);
+        ++r.stats.expanded;
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    r.stats.millis = std::chrono::duration<double,std::milli>(t1-t0).count();
+    if (x != gx || y != gy) { r.path.clear(); return r; }
+    r.found = true;
+    r.cost  = cost;
+    return r;
+}
+
+bool FirstMoveTable::save(const std::string& filepath) const {
+    std::ofstream out(filepath, std::ios::binary);
+    if (!out.is_open()) return false;
+    const int32_t w = width_, h = height_;
+    const uint32_t diag = diag_ ? 1u : 0u;
+    const uint64_t nrows = row_off_.size(), nruns = runs_.size();
+    out.write(kMagic, 4);
+    out.write(reinterpret_cast<const char*>(&kVersion), sizeof(kVersion));
+    out.write(reinterpret_cast<const char*>(&w), sizeof(w));
+    out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    out.write(reinterpret_cast<const char*>(&diag), sizeof(diag));
+    out.write(reinterpret_cast<const char*>(&hash_), sizeof(hash_));
+    out.write(reinterpret_cast<const char*>(&nrows), sizeof(nrows));
+    out.write(reinterpret_cast<const char*>(&nruns), sizeof(nruns));
+    out.write(reinterpret_cast<const char*>(row_off_.data()), (std::streamsize)(nrows * sizeof(uint64_t)));
+    out.write(reinterpret_cast<const char*>(runs_.data()), (std::streamsize)(nruns * sizeof(uint32_t)));
+    return (bool)out;
+}
+
+bool FirstMoveTable::load(const std::string& filepath, const GridMap& map, bool allow_diagonal) {
+    std::ifstream in(filepath, std::ios::binary);
+    if (!in.is_open()) return false;
+
+    char magic[4];
+    uint32_t version = 0, diag = 0;
+    int32_t w = 0, h = 0;
+    uint64_t hash = 0, nrows = 0, nruns = 0;
+    in.read(magic, 4);
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    in.read(reinterpret_cast<char*>(&w), sizeof(w));
+    in.read(reinterpret_cast<char*>(&h), sizeof(h));
+    in.read(reinterpret_cast<char*>(&diag), sizeof(diag));
+    in.read(reinterpret_cast<char*>(&hash), sizeof(hash));
+    in.read(reinterpret_cast<char*>(&nrows), sizeof(nrows));
+    in.read(reinterpret_cast<char*>(&nruns), sizeof(nruns));
+    if (!in || std::memcmp(magic, kMagic, 4) != 0 || version != kVersion) return false;
+    if (w != map.width() || h != map.height() || (diag != 0) != allow_diagonal) return false;
+    if (hash != map.occupancy_hash()) return false; // 같은 이름, 다른 맵
+
+    // free 칸 순번은 맵에서 다시 계산 (저장하지 않음)
+    std::vector<int32_t> rank((size_t)w * h, -1);
+    int32_t F = 0;
+    for (int y = 0; y < h; ++y)
+        for (int x = 0; x < w; ++x)
+            if (map.is_free(x, y)) rank[(size_t)y * w + x] = F++;
+    if (nrows != (uint64_t)F + 1) return false;
+    // 남은 바이트가 두 배열 크기와 정확히 같아야 한다 (손상된 nruns로 거대한 할당 방지)
+    const std::streamoff body = in.tellg();
+    in.seekg(0, std::ios::end);
+    const uint64_t rest = (uint64_t)(in.tellg() - body);
+    in.seekg(body);
+    if (nruns > rest / sizeof(uint32_t) || rest != nrows * sizeof(uint64_t) + nruns * sizeof(uint32_t)) return false;
+
+    std::vector<uint64_t> off(nrows);
+    std::vector<uint32_t> runs(nruns);
+    in.read(reinterpret_cast<char*>(off.data()), (std::streamsize)(nrows * sizeof(uint64_t)));
+    in.read(reinterpret_cast<char*>(runs.data()), (std::streamsize)(nruns * sizeof(uint32_t)));
+    if (!in || off[0] != 0 || off.back() != nruns) return false;
+
+    // 구조 검증: 행은 비어 있지 않고(오프셋 증가), 첫 run은 0에서 시작해 시작 순번이 증가하며
+    // 범위 안, 이동 코드는 kNone 이하 — 아니면 move_from/path가 범위 밖을 읽는다
+    for (uint64_t r = 0; r + 1 < nrows; ++r) {
+        if (off[r + 1] <= off[r]) return false;
+        if (run_start(runs[off[r]]) != 0) return false;
+        for (uint64_t i = off[r]; i < off[r + 1]; ++i) {
+            if (run_move(runs[i]) > kNone || run_start(runs[i]) >= (uint32_t)F) return false;
+            if (i > off[r] && run_start(runs[i]) <= run_start(runs[i - 1])) return false;
+        }
+    }
+
+    width_ = w; height_ = h; diag_ = diag != 0; hash_ = hash;
+    rank_.swap(rank);
+    row_off_.swap(off);
+    runs_.swap(runs);
+    return true;
+}
+
+bool FirstMoveTable::load_or_build(const std::string& map_path, const GridMap& map,
+                                   bool allow_diagonal, unsigned threads) {
+    const std::string path = default_path(map_path);
+    if (load(path, map, allow_diagonal)) return true;
+    build(map, allow_diagonal, threads);
+    save(path); // 저장 실패(읽기 전용 등)는 치명적이지 않음
+    return false;
+}
+
+} // namespace pathlab
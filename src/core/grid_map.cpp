@@ -1,32 +1,275 @@
 // src/core/grid_map.cpp
 #include "pathlab/core/grid_map.hpp"
+#include "pathlab/io/mapped_file.hpp"
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <climits>
+#include <cstring>
 #include <fstream>
-#include <stdexcept>
+#include <string_view>
 
 namespace pathlab {
 
-    bool GridMap::load_from_file(const std::string& filepath) {
-        std::ifstream in(filepath);
-        if (!in.is_open()) return false;
-    
-        grid_.clear();
-        std::string line;
-        bool map_section = false;
-        while (std::getline(in, line)) {
-            if (!line.empty() && line.back() == '\r') line.pop_back(); // <-- add this
+namespace {
+    const char     kMagic[4] = { 'P', 'L', 'G', 'M' };
+    const uint32_t kVersion  = 2;
+    const uint32_t kHasMasks = 1u;
+
+    // 바이너리 헤더 (40바이트, 뒤따르는 비트보드가 8바이트 정렬되도록)
+    struct BinaryHeader {
+        char     magic[4];
+        uint32_t version;
+        int32_t  width, height;
+        uint32_t flags;
+        uint32_t row_words;
+        uint64_t free_cells;  // 정보용
+        uint64_t checksum;    // 본문(비트보드 + 마스크) body_checksum
+    };
+    static_assert(sizeof(BinaryHeader) == 40, "BinaryHeader layout");
+
+    // 본문 체크섬: 8바이트 워드 단위 FNV-1a 변형 (바이트 단위보다 8배 적은 곱셈, 끝 조각은 0으로 채움)
+    uint64_t body_checksum(const char* p, size_t n) {
+        uint64_t h = 1469598103934665603ULL;
+        const char* end = p + n;
+        for (; end - p >= 8; p += 8) {
+            uint64_t w;
+            std::memcpy(&w, p, 8);
+            h = (h ^ w) * 1099511628211ULL;
+        }
+        if (p < end) {
+            uint64_t w = 0;
+            std::memcpy(&w, p, (size_t)(end - p));
+            h = (h ^ w) * 1099511628211ULL;
+        }
+        return h;
+    }
+
+    // "key value" 헤더 줄에서 정수 값 (key가 다르면 -1)
+    int header_int(std::string_view line, std::string_view key) {
+        if (line.size() <= key.size() || line.substr(0, key.size()) != key || line[key.size()] != ' ') return -1;
+        int v = -1;
+        const char* b = line.data() + key.size() + 1;
+        std::from_chars(b, line.data() + line.size(), v);
+        return v;
+    }
+}
+
+GridMap& GridMap::operator=(const GridMap& o) {
+    if (this == &o) return *this;
+    width_  = o.width_;
+    height_ = o.height_;
+    occ_       = o.occ_;
+    nbr_store_ = o.nbr_store_;
+    row_store_ = o.row_store_;
+    col_bits_  = o.col_bits_;
+    mapping_   = o.mapping_;
+    // 직접 계산한 배열은 내 사본을, 매핑을 가리키던 포인터는 그대로 (매핑 공유)
+    nbr_      = o.nbr_store_.empty() ? o.nbr_ : nbr_store_.data();
+    row_bits_ = o.row_store_.empty() ? o.row_bits_ : row_store_.data();
+    return *this;
+}
+
+void GridMap::reset() {
+    width_ = height_ = 0;
+    occ_.clear(); nbr_store_.clear(); row_store_.clear(); col_bits_.clear();
+    nbr_ = nullptr; row_bits_ = nullptr;
+    mapping_.reset();
+}
+
+bool GridMap::load_from_file(const std::string& filepath) {
+    auto mf = std::make_shared<MappedFile>();
+    if (!mf->open(filepath)) return false;
+    reset();
+    if (mf->size() >= sizeof(kMagic) && std::memcmp(mf->data(), kMagic, sizeof(kMagic)) == 0)
+        return load_binary(std::move(mf));
+    return load_ascii(mf->data(), mf->size()); // 파싱 후 매핑은 해제
+}
+
+bool GridMap::load_ascii(const char* data, size_t size) {
+    std::vector<std::string_view> rows; // 원본 라인 ('.', '@', 'T' 등)
+    int hdr_w = -1, hdr_h = -1;
+    bool map_section = false;
+
+    const char* p = data;
+    const char* end = data + size;
+    while (p < end) {
+        const char* nl = static_cast<const char*>(std::memchr(p, '\n', (size_t)(end - p)));
+        const char* le = nl ? nl : end;
+        std::string_view line(p, (size_t)(le - p));
+        p = nl ? nl + 1 : end;
+        if (!line.empty() && line.back() == '\r') line.remove_suffix(1);
+
+        if (!map_section) {
             if (line == "map") { map_section = true; continue; }
-            if (!map_section) continue;
-            if (!line.empty()) grid_.push_back(line);
+            if (int v = header_int(line, "height"); v >= 0) hdr_h = v;
+            if (int v = header_int(line, "width");  v >= 0) hdr_w = v;
+            continue;
+        }
+        if (line.empty()) continue;
+        rows.push_back(line);
+        if (hdr_h >= 0 && (int)rows.size() == hdr_h) break;
+    }
+
+    // 헤더 크기 우선, 없으면 행 수/첫 행 길이
+    height_ = hdr_h >= 0 ? hdr_h : (int)rows.size();
+    width_  = hdr_w >= 0 ? hdr_w : (rows.empty() ? 0 : (int)rows[0].size());
+    if (((int64_t)width_ + 2) * ((int64_t)height_ + 2) > INT_MAX) { reset(); return false; }
+
+    // 패딩 점유 배열 구성 (테두리 1칸 = 장애물)
+    occ_.assign((size_t)padded_size(), 0);
+    for (int y = 0; y < std::min<int>(height_, (int)rows.size()); ++y) {
+        const std::string_view row = rows[y];
+        const int n = std::min<int>(width_, (int)row.size());
+        uint8_t* dst = occ_.data() + to_padded(0, y);
+        for (int x = 0; x < n; ++x) dst[x] = (row[x] == '.'); // '.'만 free
+    }
+    build_neighbor_masks();
+    build_row_bits();
+    build_col_bits();
+    return height_ > 0 && width_ > 0;
+}
+
+bool GridMap::load_binary(std::shared_ptr<const MappedFile> mf) {
+    if (mf->size() < sizeof(BinaryHeader)) return false;
+    BinaryHeader h;
+    std::memcpy(&h, mf->data(), sizeof(h));
+    if (h.version != kVersion || h.width <= 0 || h.height <= 0) return false;
+    if (((int64_t)h.width + 2) * ((int64_t)h.height + 2) > INT_MAX) return false;
+
+    width_ = h.width; height_ = h.height;
+    const size_t bits_bytes = (size_t)padded_height() * row_words() * sizeof(uint64_t);
+    const size_t mask_bytes = (h.flags & kHasMasks) ? (size_t)padded_size() : 0;
+    const char* base = mf->data() + sizeof(h);
+    // 크기/체크섬이 맞지 않으면 손상 또는 다른 버전 → 거부 (마스크를 다시 계산해 비교하지 않는다)
+    if (h.row_words != (uint32_t)row_words() || mf->size() < sizeof(h) + bits_bytes + mask_bytes ||
+        body_checksum(base, bits_bytes + mask_bytes) != h.checksum) {
+        reset();
+        return false;
+    }
+
+    // 테두리가 장애물이 아니면 범위 검사 없는 탐색이 깨지므로 거부 (비트보드 워드에서 바로 확인)
+    row_bits_ = reinterpret_cast<const uint64_t*>(base);
+    const int PW = padded_width(), PH = padded_height(), RW = row_words();
+    const uint64_t last = uint64_t(1) << ((PW - 1) & 63);
+    bool border_ok = true;
+    for (int w = 0; w < RW; ++w) border_ok &= (row_bits_[w] | row_bits_[(size_t)(PH - 1) * RW + w]) == 0;
+    for (int py = 0; py < PH; ++py) {
+        const uint64_t* r = row_bits(py);
+        border_ok &= (r[0] & 1u) == 0 && (r[(PW - 1) >> 6] & last) == 0;
+    }
+    if (!border_ok) { reset(); return false; }
+
+    unpack_occupancy();
+    if (mask_bytes) nbr_ = reinterpret_cast<const uint8_t*>(base + bits_bytes);
+    else            build_neighbor_masks();
+    build_col_bits();
+    mapping_ = std::move(mf);
+    return true;
+}
+
+bool GridMap::save_binary(const std::string& filepath, bool with_masks) const {
+    if (width_ <= 0 || height_ <= 0) return false;
+    std::ofstream out(filepath, std::ios::binary);
+    if (!out.is_open()) return false;
+
+    BinaryHeader h{};
+    std::memcpy(h.magic, kMagic, sizeof(kMagic));
+    h.version    = kVersion;
+    h.width      = width_;
+    h.height     = height_;
+    h.flags      = with_masks ? kHasMasks : 0u;
+    h.row_words  = (uint32_t)row_words();
+    h.free_cells = (uint64_t)std::count(occ_.begin(), occ_.end(), uint8_t{1});
+    const size_t bits_bytes = (size_t)padded_height() * row_words() * sizeof(uint64_t);
+    const size_t mask_bytes = with_masks ? (size_t)padded_size() : 0;
+    // 본문은 비트보드와 마스크를 이어 붙인 바이트열 — 체크섬도 그 순서로 이어서 계산
+    std::vector<char> body(bits_bytes + mask_bytes);
+    std::memcpy(body.data(), row_bits_, bits_bytes);
+    if (with_masks) std::memcpy(body.data() + bits_bytes, nbr_, mask_bytes);
+    h.checksum = body_checksum(body.data(), body.size());
+    out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    out.write(body.data(), (std::streamsize)body.size());
+    return (bool)out;
+}
+
+void GridMap::build_neighbor_masks() {
+    const int PW = padded_width();
+    nbr_store_.assign(occ_.size(), 0);
+    for (int y = 0; y < height_; ++y) {
+        for (int p = to_padded(0, y), e = p + width_; p < e; ++p) {
+            if (!occ_[p]) continue;
+            uint8_t m = 0;
+            for (int k = 0; k < 8; ++k) {
+                if (!occ_[p + DIR_DX[k] + DIR_DY[k]*PW]) continue;
+                // 대각선 corner-cutting 방지: 양옆 직교 칸이 모두 free여야 함
+                if (k >= 4 && (!occ_[p + DIR_DX[k]] || !occ_[p + DIR_DY[k]*PW])) continue;
+                m |= uint8_t(1u << k);
+            }
+            nbr_store_[p] = m;
+        }
+    }
+    nbr_ = nbr_store_.data();
+}
+
+void GridMap::build_row_bits() {
+    const int PW = padded_width(), PH = padded_height();
+    const int RW = row_words();
+    row_store_.assign((size_t)PH * RW, 0);
+    for (int py = 0; py < PH; ++py) {
+        const uint8_t* row = occ_.data() + (size_t)py * PW;
+        for (int px = 0; px < PW; ++px)
+            if (row[px]) row_store_[(size_t)py * RW + (px >> 6)] |= uint64_t(1) << (px & 63);
+    }
+    row_bits_ = row_store_.data();
+}
+
+void GridMap::build_col_bits() {
+    const int PW = padded_width(), PH = padded_height();
+    const int CW = col_words();
+    col_bits_.assign((size_t)PW * CW, 0);
+    for (int py = 0; py < PH; ++py) {
+        const uint8_t* row = occ_.data() + (size_t)py * PW;
+        for (int px = 0; px < PW; ++px)
+            if (row[px]) col_bits_[(size_t)px * CW + (py >> 6)] |= uint64_t(1) << (py & 63);
+    }
+}
+
+// 행 비트보드 → 바이트 점유 배열 (8비트씩 표로 펼쳐 8바이트 한 번에 쓴다, 리틀 엔디언)
+void GridMap::unpack_occupancy() {
+    static const auto spread = [] {
+        std::array<uint64_t, 256> t{};
+        for (int b = 0; b < 256; ++b)
+            for (int i = 0; i < 8; ++i) if (b >> i & 1) t[b] |= uint64_t(1) << (8 * i);
+        return t;
+    }();
+    const int PW = padded_width(), PH = padded_height();
+    const int RW = row_words();
+    occ_.resize((size_t)padded_size());
+    for (int py = 0; py < PH; ++py) {
+        const uint64_t* bits = row_bits_ + (size_t)py * RW;
+        uint8_t* row = occ_.data() + (size_t)py * PW;
+        int px = 0;
+        for (; px + 8 <= PW; px += 8) {
+            const uint64_t bytes = spread[(bits[px >> 6] >> (px & 63)) & 0xFFu];
+            std::memcpy(row + px, &bytes, 8);
         }
-        height_ = (int)grid_.size();
-        width_  = height_ ? (int)grid_[0].size() : 0;
-        return height_ > 0 && width_ > 0;
+        for (; px < PW; ++px) row[px] = uint8_t((bits[px >> 6] >> (px & 63)) & 1u);
+    }
+}
+
+uint64_t GridMap::occupancy_hash() const {
+    uint64_t h = 1469598103934665603ULL;
+    for (uint8_t c : occ_) {
+        h ^= c;
+        h *= 1099511628211ULL;
     }
+    return h;
+}
 
 bool GridMap::is_free(int x, int y) const {
     if (y < 0 || y >= height_ || x < 0 || x >= width_) return false;
-    char c = grid_[y][x];
-    return c == '.'; // '.'만 free, '@'나 'T'는 obstacle
+    return occ_[to_padded(x, y)] != 0; // '.'만 free, '@'나 'T'는 obstacle
 }
 
 } // namespace pathlab
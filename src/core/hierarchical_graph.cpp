@@ -0,0 +1,251 @@
+// src/core/hierarchical_graph.cpp
+#include "pathlab/core/hierarchical_graph.hpp"
+#include "pathlab/util/thread_pool.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+
+namespace pathlab {
+
+namespace {
+    const char     kMagic[4] = { 'P', 'L', 'H', 'P' };
+    const uint32_t kVersion  = 1;
+
+    // 격자 뷰를 클러스터 박스 [x0,x1)×[y0,y1) 안으로 제한한 SearchGraph.
+    // 대각 이동의 양옆 칸은 두 칸의 bounding box 안 → 도착 칸이 박스 안이면 충분.
+    struct ClusterGraph {
+        GridGraph grid;
+        int x0, y0, x1, y1;
+
+        size_t node_count() const { return grid.node_count(); }
+
+        template <class F>
+        void for_each_out(int u, F&& f) const {
+            const int ux = grid.map->padded_x(u), uy = grid.map->padded_y(u);
+            grid.for_each_move(u, [&](int k, int v, double w) {
+                const int vx = ux + DIR_DX[k], vy = uy + DIR_DY[k];
+                if (vx >= x0 && vx < x1 && vy >= y0 && vy < y1) f(v, w);
+            });
+        }
+    };
+}
+
+void HierarchicalGraph::build(const GridMap& map, int cluster_size, bool allow_diagonal, unsigned threads) {
+    const int W = map.width(), H = map.height();
+    const int C = std::max(2, cluster_size);
+    width_ = W; height_ = H; csize_ = C; diag_ = allow_diagonal;
+    ccols_ = (W + C - 1) / C;
+    crows_ = (H + C - 1) / C;
+    hash_ = map.occupancy_hash();
+
+    // ---- entrance → 전이 칸 쌍 ----
+    std::vector<int> node_at((size_t)map.padded_size(), -1);
+    std::vector<int> cells;                   // 임시 노드 → 패딩 칸
+    std::vector<std::pair<int,int>> inter;    // 임시 노드 쌍
+    auto node = [&](int p) {
+        if (node_at[p] < 0) { node_at[p] = (int)cells.size(); cells.push_back(p); }
+        return node_at[p];
+    };
+    // 경계를 따라 [a0,a1)을 훑어 open 구간마다 전이 위치를 emit
+    auto scan = [&](int a0, int a1, auto&& open, auto&& emit) {
+        for (int a = a0; a < a1; ) {
+            if (!open(a)) { ++a; continue; }
+            int b = a;
+            while (b + 1 < a1 && open(b + 1)) ++b;
+            if (b - a + 1 < kWideEntrance) emit((a + b) / 2);
+            else { emit(a); emit(b); }
+            a = b + 1;
+        }
+    };
+    for (int x = C - 1; x + 1 < W; x += C)          // 세로 경계: 열 x | x+1
+        for (int y0 = 0; y0 < H; y0 += C)
+            scan(y0, std::min(y0 + C, H),
+                 [&](int y) { return map.is_free(x, y) && map.is_free(x + 1, y); },
+                 [&](int y) { inter.emplace_back(node(map.to_padded(x, y)), node(map.to_padded(x + 1, y))); });
+    for (int y = C - 1; y + 1 < H; y += C)          // 가로 경계: 행 y / y+1
+        for (int x0 = 0; x0 < W; x0 += C)
+            scan(x0, std::min(x0 + C, W),
+                 [&](int x) { return map.is_free(x, y) && map.is_free(x, y + 1); },
+                 [&](int x) { inter.emplace_back(node(map.to_padded(x, y)), node(map.to_padded(x, y + 1))); });
+
+    // ---- (클러스터, 칸) 순 정렬 ----
+    const size_t N = cells.size();
+    auto cluster_of_cell = [&](int p) { return cluster_of(map.padded_x(p), map.padded_y(p)); };
+    std::vector<int> order(N), rank(N);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int a, int b) {
+        const int ca = cluster_of_cell(cells[a]), cb = cluster_of_cell(cells[b]);
+        return ca != cb ? ca < cb : cells[a] < cells[b];
+    });
+    node_cell_.resize(N);
+    node_cluster_.resize(N);
+    cluster_begin_.assign((size_t)cluster_count() + 1, 0);
+    for (size_t i = 0; i < N; ++i) {
+        rank[order[i]] = (int)i;
+        node_cell_[i] = cells[order[i]];
+        node_cluster_[i] = cluster_of_cell(node_cell_[i]);
+        ++cluster_begin_[node_cluster_[i] + 1];
+    }
+    for (int c = 0; c < cluster_count(); ++c) cluster_begin_[c + 1] += cluster_begin_[c];
+
+    // ---- intra 간선 (클러스터별 병렬) ----
+    std::vector<std::vector<Edge>> adj(N);
+    ThreadPool pool(std::max(1u, threads));
+    std::vector<LocalWorkspace> ws(pool.size());
+    std::vector<std::vector<double>> dists(pool.size());
+    pool.parallel_for((size_t)cluster_count(), /*grain=*/1, [&](unsigned w, size_t c) {
+        const int b = cluster_begin_[c], e = cluster_begin_[c + 1];
+        std::vector<double>& d = dists[w];
+        d.resize((size_t)(e - b));
+        for (int i = b; i < e; ++i) {
+            local_search(ws[w], map, node_cell_[i], (int)c, node_cell_.data() + b, (size_t)(e - b), d.data());
+            for (int j = b; j < e; ++j)
+                if (j != i && d[j - b] < SearchContext::INF) adj[i].push_back(Edge{ j, d[j - b] });
+        }
+    });
+    for (auto [a, b] : inter) {
+        adj[rank[a]].push_back(Edge{ rank[b], 1.0 });
+        adj[rank[b]].push_back(Edge{ rank[a], 1.0 });
+    }
+
+    edge_off_.assign(N + 1, 0);
+    for (size_t i = 0; i < N; ++i) edge_off_[i + 1] = edge_off_[i] + (uint32_t)adj[i].size();
+    edges_.clear();
+    edges_.reserve(edge_off_[N]);
+    for (auto& a : adj) edges_.insert(edges_.end(), a.begin(), a.end());
+}
+
+uint64_t HierarchicalGraph::local_search(LocalWorkspace& ws, const GridMap& map, int src, int cluster,
+                                         const int* targets, size_t n_targets, double* dist) const {
+    const int x0 = (cluster % ccols_) * csize_, y0 = (cluster / ccols_) * csize_;
+    const int x1 = std::min(x0 + csize_, width_), y1 = std::min(y0 + csize_, height_);
+    const ClusterGraph graph{ GridGraph(map, diag_), x0, y0, x1, y1 };
+
+    // 목표 표시: 클러스터 안 칸 (x-x0) + (y-y0)*C → 그 칸을 가리키는 목표 인덱스 목록 (같은 칸 중복 허용)
+    std::fill(dist, dist + n_targets, SearchContext::INF);
+    ws.head.assign((size_t)csize_ * csize_, -1);
+    ws.next.resize(n_targets);
+    size_t remaining = 0;
+    for (size_t i = 0; i < n_targets; ++i) {
+        const int tx = map.padded_x(targets[i]) - x0, ty = map.padded_y(targets[i]) - y0;
+        if (tx < 0 || ty < 0 || tx >= x1 - x0 || ty >= y1 - y0) continue;  // 박스 밖: 도달 불가
+        int& h = ws.head[(size_t)ty * csize_ + tx];
+        ws.next[i] = h;
+        h = (int)i;
+        ++remaining;
+    }
+    if (remaining == 0) return 0;
+
+    const SearchStats st = ws.engine.sweep(ws.ctx, graph, src, [](int) { return 0.0; }, [&](int u) {
+        const int l = (map.padded_y(u) - y0) * csize_ + (map.padded_x(u) - x0);
+        for (int i = ws.head[(size_t)l]; i != -1; i = ws.next[(size_t)i]) {
+            dist[i] = ws.ctx.g(u);
+            --remaining;
+        }
+        return remaining == 0;   // 마지막 목표가 확정되면 확장 없이 종료
+    });
+    return st.expanded;
+}
+
+double HierarchicalGraph::local_path(LocalWorkspace& ws, const GridMap& map, int from, int to, int cluster,
+                                     std::vector<int>& out, uint64_t* expanded) const {
+    const SearchContext& ctx = ws.ctx;
+    double d = SearchContext::INF;
+    const uint64_t ex = local_search(ws, map, from, cluster, &to, 1, &d);
+    if (expanded) *expanded += ex;
+    if (d == SearchContext::INF) return d;
+    const size_t at = out.size();
+    for (int v = to; v != from; v = ctx.parent(v)) out.push_back(map.from_padded(v));
+    std::reverse(out.begin() + (std::ptrdiff_t)at, out.end());
+    return d;
+}
+
+bool HierarchicalGraph::save(const std::string& filepath) const {
+    std::ofstream out(filepath, std::ios::binary);
+    if (!out.is_open()) return false;
+    const int32_t hdr[4] = { width_, height_, csize_, diag_ ? 1 : 0 };
+    const uint64_t n = node_cell_.size(), m = edges_.size();
+    std::vector<int32_t> to(m);
+    std::vector<double>  w(m);
+    for (size_t i = 0; i < m; ++i) { to[i] = edges_[i].to; w[i] = edges_[i].w; }
+    out.write(kMagic, 4);
+    out.write(reinterpret_cast<const char*>(&kVersion), sizeof(kVersion));
+    out.write(reinterpret_cast<const char*>(hdr), sizeof(hdr));
+    out.write(reinterpret_cast<const char*>(&hash_), sizeof(hash_));
+    out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    out.write(reinterpret_cast<const char*>(&m), sizeof(m));
+    out.write(reinterpret_cast<const char*>(node_cell_.data()), (std::streamsize)(n * sizeof(int32_t)));
+    out.write(reinterpret_cast<const char*>(edge_off_.data()), (std::streamsize)((n + 1) * sizeof(uint32_t)));
+    out.write(reinterpret_cast<const char*>(to.data()), (std::streamsize)(m * sizeof(int32_t)));
+    out.write(reinterpret_cast<const char*>(w.data()), (std::streamsize)(m * sizeof(double)));
+    return (bool)out;
+}
+
+bool HierarchicalGraph::load(const std::string& filepath, const GridMap& map, int cluster_size, bool allow_diagonal) {
+    std::ifstream in(filepath, std::ios::binary);
+    if (!in.is_open()) return false;
+
+    char magic[4];
+    uint32_t version = 0;
+    int32_t hdr[4] = {};
+    uint64_t hash = 0, n = 0, m = 0;
+    in.read(magic, 4);
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    in.read(reinterpret_cast<char*>(hdr), sizeof(hdr));
+    in.read(reinterpret_cast<char*>(&hash), sizeof(hash));
+    in.read(reinterpret_cast<char*>(&n), sizeof(n));
+    in.read(reinterpret_cast<char*>(&m), sizeof(m));
+    if (!in || std::memcmp(magic, kMagic, 4) != 0 || version != kVersion) return false;
+    if (hdr[0] != map.width() || hdr[1] != map.height() || hdr[2] != std::max(2, cluster_size)
+        || (hdr[3] != 0) != allow_diagonal) return false;
+    if (hash != map.occupancy_hash()) return false; // 같은 이름, 다른 맵
+    if (n > (uint64_t)map.padded_size() || m > n * n) return false;
+
+    std::vector<int32_t>  cells(n);
+    std::vector<uint32_t> off(n + 1);
+    std::vector<int32_t>  to(m);
+    std::vector<double>   w(m);
+    in.read(reinterpret_cast<char*>(cells.data()), (std::streamsize)(n * sizeof(int32_t)));
+    in.read(reinterpret_cast<char*>(off.data()), (std::streamsize)((n + 1) * sizeof(uint32_t)));
+    in.read(reinterpret_cast<char*>(to.data()), (std::streamsize)(m * sizeof(int32_t)));
+    in.read(reinterpret_cast<char*>(w.data()), (std::streamsize)(m * sizeof(double)));
+    if (!in || off[0] != 0 || off.back() != m) return false;
+    for (size_t i = 0; i < n; ++i) if (off[i] > off[i + 1]) return false;   // CSR 오프셋은 비감소
+    for (int32_t c : cells) if (c < 0 || c >= map.padded_size() || !map.is_free_fast(c)) return false;
+    for (int32_t t : to) if (t < 0 || (uint64_t)t >= n) return false;
+
+    const int C = hdr[2];
+    const int cols = (hdr[0] + C - 1) / C, rows = (hdr[1] + C - 1) / C;
+    std::vector<int> cl(n);
+    for (size_t i = 0; i < n; ++i) {
+        cl[i] = (map.padded_y(cells[i]) / C) * cols + map.padded_x(cells[i]) / C;
+        if (i > 0 && cl[i] < cl[i - 1]) return false;   // cluster_begin_은 클러스터별로 모여 있다고 가정
+    }
+
+    width_ = hdr[0]; height_ = hdr[1]; csize_ = C; diag_ = hdr[3] != 0; hash_ = hash;
+    ccols_ = cols;
+    crows_ = rows;
+    node_cell_.swap(cells);
+    node_cluster_.swap(cl);
+    cluster_begin_.assign((size_t)cluster_count() + 1, 0);
+    for (size_t i = 0; i < n; ++i) ++cluster_begin_[node_cluster_[i] + 1];
+    for (int c = 0; c < cluster_count(); ++c) cluster_begin_[c + 1] += cluster_begin_[c];
+    edge_off_.swap(off);
+    edges_.resize(m);
+    for (size_t i = 0; i < m; ++i) edges_[i] = Edge{ to[i], w[i] };
+    return true;
+}
+
+bool HierarchicalGraph::load_or_build(const std::string& map_path, const GridMap& map, int cluster_size,
+                                      bool allow_diagonal, unsigned threads) {
+    const std::string path = default_path(map_path);
+    if (load(path, map, cluster_size, allow_diagonal)) return true;
+    build(map, cluster_size, allow_diagonal, threads);
+    save(path); // 저장 실패(읽기 전용 등)는 치명적이지 않음
+    return false;
+}
+
+} // namespace pathlab
@@ -0,0 +1,114 @@
+// src/core/jump_table.cpp
+#include "pathlab/core/jump_table.hpp"
+#include <cstring>
+#include <fstream>
+
+namespace pathlab {
+
+namespace {
+    const char     kMagic[4] = { 'P', 'L', 'J', 'P' };
+    const uint32_t kVersion  = 1;
+}
+
+void JumpTable::build(const GridMap& map) {
+    const int PW = map.padded_width();
+    const int N  = map.padded_size();
+    const uint8_t* OCC = map.occupancy();
+    const uint8_t* NM  = map.neighbor_masks();
+
+    width_  = map.width();
+    height_ = map.height();
+    hash_   = map.occupancy_hash();
+    dist_.clear();
+    if (!supports(map)) return;   // int16 거리가 넘칠 수 있음
+    dist_.assign((size_t)N * 8, 0);
+
+    int OFF[8];
+    for (int k = 0; k < 8; ++k) OFF[k] = DIR_DX[k] + DIR_DY[k] * PW;
+
+    // 다음 칸(q = p + off)의 값을 먼저 계산하도록 off 부호에 따라 순회 방향을 정한다.
+    auto sweep = [&](int k, auto&& stop_at) {
+        const int off = OFF[k];
+        const int b = off > 0 ? N - 1 : 0, e = off > 0 ? -1 : N, step = off > 0 ? -1 : 1;
+        for (int p = b; p != e; p += step) {
+            int16_t& d = dist_[(size_t)p * 8 + k];
+            if (!OCC[p] || !((NM[p] >> k) & 1)) { d = 0; continue; }
+            const int q = p + off;
+            if (stop_at(q)) { d = 1; continue; }
+            const int16_t t = dist_[(size_t)q * 8 + k];
+            d = t > 0 ? int16_t(t + 1) : int16_t(t - 1);
+        }
+    };
+
+    // 직선: q에 강제 이웃이 있으면 jump point
+    for (int k = 0; k < 4; ++k) {
+        const int off = OFF[k];
+        const int side = (k < 2) ? PW : 1;
+        sweep(k, [&](int q) {
+            return (OCC[q + side] && !OCC[q - off + side]) ||
+                   (OCC[q - side] && !OCC[q - off - side]);
+        });
+    }
+    // 대각: q에서 두 직교 성분 방향 직선 점프가 jump point에 닿으면 jump point
+    for (int k = 4; k < 8; ++k) {
+        const int kx = DIR_DX[k] > 0 ? 0 : 1;
+        const int ky = DIR_DY[k] > 0 ? 2 : 3;
+        sweep(k, [&](int q) {
+            return dist_[(size_t)q * 8 + kx] > 0 || dist_[(size_t)q * 8 + ky] > 0;
+        });
+    }
+}
+
+bool JumpTable::save(const std::string& filepath) const {
+    std::ofstream out(filepath, std::ios::binary);
+    if (!out.is_open()) return false;
+    const int32_t w = width_, h = height_;
+    const uint64_t n = dist_.size();
+    out.write(kMagic, 4);
+    out.write(reinterpret_cast<const char*>(&kVersion), sizeof(kVersion));
+    out.write(reinterpret_cast<const char*>(&w), sizeof(w));
+    out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    out.write(reinterpret_cast<const char*>(&hash_), sizeof(hash_));
+    out.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    out.write(reinterpret_cast<const char*>(dist_.data()), (std::streamsize)(n * sizeof(int16_t)));
+    return (bool)out;
+}
+
+bool JumpTable::load(const std::string& filepath, const GridMap& map) {
+    std::ifstream in(filepath, std::ios::binary);
+    if (!in.is_open()) return false;
+
+    char magic[4];
+    uint32_t version = 0;
+    int32_t w = 0, h = 0;
+    uint64_t hash = 0, n = 0;
+    in.read(magic, 4);
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    in.read(reinterpret_cast<char*>(&w), sizeof(w));
+    in.read(reinterpret_cast<char*>(&h), sizeof(h));
+    in.read(reinterpret_cast<char*>(&hash), sizeof(hash));
+    in.read(reinterpret_cast<char*>(&n), sizeof(n));
+    if (!in || std::memcmp(magic, kMagic, 4) != 0 || version != kVersion) return false;
+    if (w != map.width() || h != map.height()) return false;
+    if (!supports(map)) return false;
+    if (n != (uint64_t)map.padded_size() * 8) return false;
+    if (hash != map.occupancy_hash()) return false; // 같은 이름, 다른 맵
+
+    std::vector<int16_t> d(n);
+    in.read(reinterpret_cast<char*>(d.data()), (std::streamsize)(n * sizeof(int16_t)));
+    if (!in) return false;
+
+    width_ = w; height_ = h; hash_ = hash;
+    dist_.swap(d);
+    return true;
+}
+
+bool JumpTable::load_or_build(const std::string& map_path, const GridMap& map) {
+    const std::string path = default_path(map_path);
+    if (load(path, map)) return true;
+    build(map);
+    if (!empty()) save(path); // 저장 실패(읽기 전용 등)는 치명적이지 않음
+    return false;
+}
+
+} // namespace pathlab
@@ -0,0 +1,147 @@
+// src/core/landmark_table.cpp
+#include "pathlab/core/landmark_table.hpp"
+#include "pathlab/algorithms/dijkstra.hpp"
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+namespace pathlab {
+
+namespace {
+    const char     kMagic[4] = { 'P', 'L', 'A', 'L' };
+    const uint32_t kVersion  = 1;
+    const int      kMaxLandmarks = 64;
+
+    // float 두 값 차의 반올림 오차 상한 (최대 거리 기준, 여유 2배)
+    double rounding_eps(const std::vector<float>& d) {
+        float m = 0.0f;
+        for (float v : d) m = std::max(m, v);
+        return (double)m * std::ldexp(1.0, -22);
+    }
+}
+
+void LandmarkTable::build(const GridMap& map, int k, bool allow_diagonal) {
+    const int W = map.width(), H = map.height();
+    const size_t cells = (size_t)W * H;
+    k = std::clamp(k, 1, kMaxLandmarks);
+
+    requested_ = k;
+    width_ = W; height_ = H; diag_ = allow_diagonal;
+    hash_ = map.occupancy_hash();
+    lm_.clear();
+    dist_.clear();
+    k_ = 0;
+
+    // 첫 free 칸 (없으면 빈 테이블)
+    int seed = -1;
+    for (size_t c = 0; c < cells && seed < 0; ++c)
+        if (map.is_free((int)(c % W), (int)(c / W))) seed = (int)c;
+    if (seed < 0) return;
+
+    Dijkstra dij;
+    SearchContext ctx;
+    const double INF = std::numeric_limits<double>::infinity();
+    // 칸 c에서 전체 Dijkstra → out[c'] (도달 불가 INF)
+    auto sweep_from = [&](int c, std::vector<double>& out) {
+        dij.sweep(ctx, map, map.to_padded(c % W, c / W), 0, 0, allow_diagonal, ZeroH{},
+                  [](int) { return false; });
+        out.resize(cells);
+        for (size_t i = 0; i < cells; ++i) out[i] = ctx.g(map.to_padded((int)(i % W), (int)(i / W)));
+    };
+    auto farthest = [&](const std::vector<double>& d) {
+        int best = -1;
+        double bv = -1.0;
+        for (size_t i = 0; i < cells; ++i)
+            if (d[i] < INF && d[i] > bv) { bv = d[i]; best = (int)i; }
+        return std::make_pair(best, bv);
+    };
+
+    std::vector<double> d, mind;
+    sweep_from(seed, d);
+    int next = farthest(d).first;
+
+    std::vector<std::vector<float>> cols;
+    while ((int)lm_.size() < k) {
+        lm_.push_back(next);
+        sweep_from(next, d);
+        std::vector<float> col(cells);
+        for (size_t i = 0; i < cells; ++i) col[i] = d[i] < INF ? (float)d[i] : -1.0f;
+        cols.push_back(std::move(col));
+
+        if (mind.empty()) mind = d;
+        else for (size_t i = 0; i < cells; ++i) mind[i] = std::min(mind[i], d[i]);
+        auto [cand, gap] = farthest(mind);
+        if (cand < 0 || gap <= 0.0) break; // 성분이 너무 작아 새 랜드마크가 없음
+        next = cand;
+    }
+
+    // 칸 우선 배치로 전치
+    k_ = (int)lm_.size();
+    dist_.resize(cells * k_);
+    for (size_t i = 0; i < cells; ++i)
+        for (int j = 0; j < k_; ++j) dist_[i * k_ + j] = cols[j][i];
+    eps_ = rounding_eps(dist_);
+}
+
+bool LandmarkTable::save(const std::string& filepath) const {
+    std::ofstream out(filepath, std::ios::binary);
+    if (!out.is_open()) return false;
+    const int32_t w = width_, h = height_, k = k_, kreq = requested_;
+    const uint32_t diag = diag_ ? 1u : 0u;
+    out.write(kMagic, 4);
+    out.write(reinterpret_cast<const char*>(&kVersion), sizeof(kVersion));
+    out.write(reinterpret_cast<const char*>(&w), sizeof(w));
+    out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    out.write(reinterpret_cast<const char*>(&k), sizeof(k));
+    out.write(reinterpret_cast<const char*>(&kreq), sizeof(kreq));
+    out.write(reinterpret_cast<const char*>(&diag), sizeof(diag));
+    out.write(reinterpret_cast<const char*>(&hash_), sizeof(hash_));
+    out.write(reinterpret_cast<const char*>(lm_.data()), (std::streamsize)(lm_.size() * sizeof(int32_t)));
+    out.write(reinterpret_cast<const char*>(dist_.data()), (std::streamsize)(dist_.size() * sizeof(float)));
+    return (bool)out;
+}
+
+bool LandmarkTable::load(const std::string& filepath, const GridMap& map, int k, bool allow_diagonal) {
+    std::ifstream in(filepath, std::ios::binary);
+    if (!in.is_open()) return false;
+
+    char magic[4];
+    uint32_t version = 0, diag = 0;
+    int32_t w = 0, h = 0, kk = 0, kreq = 0;
+    uint64_t hash = 0;
+    in.read(magic, 4);
+    in.read(reinterpret_cast<char*>(&version), sizeof(version));
+    in.read(reinterpret_cast<char*>(&w), sizeof(w));
+    in.read(reinterpret_cast<char*>(&h), sizeof(h));
+    in.read(reinterpret_cast<char*>(&kk), sizeof(kk));
+    in.read(reinterpret_cast<char*>(&kreq), sizeof(kreq));
+    in.read(reinterpret_cast<char*>(&diag), sizeof(diag));
+    in.read(reinterpret_cast<char*>(&hash), sizeof(hash));
+    if (!in || std::memcmp(magic, kMagic, 4) != 0 || version != kVersion) return false;
+    if (w != map.width() || h != map.height() || (diag != 0) != allow_diagonal) return false;
+    // 실제 수(kk)는 작은 성분 때문에 요청(kreq)보다 적을 수 있다
+    if (kreq != std::clamp(k, 1, kMaxLandmarks) || kk <= 0 || kk > kreq) return false;
+    if (hash != map.occupancy_hash()) return false; // 같은 이름, 다른 맵
+
+    std::vector<int> lm((size_t)kk);
+    std::vector<float> d((size_t)w * h * kk);
+    in.read(reinterpret_cast<char*>(lm.data()), (std::streamsize)(lm.size() * sizeof(int32_t)));
+    in.read(reinterpret_cast<char*>(d.data()), (std::streamsize)(d.size() * sizeof(float)));
+    if (!in) return false;
+
+    width_ = w; height_ = h; k_ = kk; requested_ = kreq; diag_ = diag != 0; hash_ = hash;
+    lm_.swap(lm);
+    dist_.swap(d);
+    eps_ = rounding_eps(dist_);
+    return true;
+}
+
+bool LandmarkTable::load_or_build(const std::string& map_path, const GridMap& map, int k, bool allow_diagonal) {
+    const std::string path = default_path(map_path);
+    if (load(path, map, k, allow_diagonal)) return true;
+    build(map, k, allow_diagonal);
+    save(path); // 저장 실패(읽기 전용 등)는 치명적이지 않음
+    return false;
+}
+
+} // namespace pathlab
@@ -0,0 +1,34 @@
+// src/io/mapped_file.cpp
+#include "pathlab/io/mapped_file.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace pathlab {
+
+bool MappedFile::open(const std::string& filepath) {
+    close();
+    const int fd = ::open(filepath.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0) { ::close(fd); return false; }
+    size_ = (size_t)st.st_size;
+    if (size_ == 0) { ::close(fd); return true; }
+
+    void* p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd); // 매핑은 fd와 무관하게 유지됨
+    if (p == MAP_FAILED) { size_ = 0; return false; }
+    ::madvise(p, size_, MADV_SEQUENTIAL);
+    data_ = static_cast<const char*>(p);
+    return true;
+}
+
+void MappedFile::close() {
+    if (data_) ::munmap(const_cast<char*>(data_), size_);
+    data_ = nullptr;
+    size_ = 0;
+}
+
+} // namespace pathlab
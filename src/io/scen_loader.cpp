@@ -1,31 +1,144 @@
 // src/io/scen_loader.cpp
 #include "pathlab/io/scen_loader.hpp"
-#include <fstream>
-#include <sstream>
+#include "pathlab/io/mapped_file.hpp"
+#include "pathlab/util/thread_pool.hpp"
+#include <charconv>
+#include <cstring>
+#include <string_view>
+#include <unordered_map>
 
 namespace pathlab {
 
-bool ScenarioLoader::load_from_file(const std::string& filepath) {
-    std::ifstream in(filepath);
-    if (!in.is_open()) return false;
+namespace {
 
-    scenarios_.clear();
-    std::string line;
-    while (std::getline(in, line)) {
-        if (line.empty() || line[0] == 'v' || line[0] == 't') continue; // 헤더 스킵
+// 청크 하나의 파싱 결과 (map_id는 청크 로컬 이름표 기준)
+struct Chunk {
+    std::vector<int32_t>  sx, sy, gx, gy, bucket;
+    std::vector<double>   opt;
+    std::vector<uint32_t> map_id;
+    std::vector<std::string_view> names;
+};
+
+inline bool is_space(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+// 공백을 건너뛰고 토큰 하나 (줄 끝이면 false)
+inline bool next_token(const char*& p, const char* e, std::string_view& tok) {
+    while (p < e && is_space(*p)) ++p;
+    const char* b = p;
+    while (p < e && !is_space(*p)) ++p;
+    tok = std::string_view(b, (size_t)(p - b));
+    return !tok.empty();
+}
+
+template <class T>
+inline bool next_number(const char*& p, const char* e, T& v) {
+    while (p < e && is_space(*p)) ++p;
+    auto [q, ec] = std::from_chars(p, e, v);
+    if (ec != std::errc() || (q < e && !is_space(*q))) return false;
+    p = q;
+    return true;
+}
+
+// "bucket map w h sx sy gx gy opt" 한 줄
+void parse_range(const char* p, const char* end, Chunk& c) {
+    // 줄 길이 ~40바이트 가정으로 미리 확보
+    const size_t est = (size_t)(end - p) / 40 + 1;
+    for (auto* v : { &c.sx, &c.sy, &c.gx, &c.gy, &c.bucket }) v->reserve(est);
+    c.opt.reserve(est); c.map_id.reserve(est);
+
+    std::unordered_map<std::string_view, uint32_t> ids;
+    std::string_view last_name;  // 보통 파일 전체가 같은 맵 → 해시 조회 생략
+    uint32_t last_id = 0;
+    while (p < end) {
+        const char* nl = static_cast<const char*>(std::memchr(p, '\n', (size_t)(end - p)));
+        const char* le = nl ? nl : end;
+        const char* q = p;
+        p = nl ? nl + 1 : end;
 
-        std::istringstream iss(line);
         int bucket, map_w, map_h, sx, sy, gx, gy;
         double opt;
-        std::string mapfile;
-        if (iss >> bucket >> mapfile >> map_w >> map_h >> sx >> sy >> gx >> gy >> opt) {
-            Scenario s;
-            s.start = {sx, sy};
-            s.goal  = {gx, gy};
-            s.optimal_length = opt;
-            s.map_name = mapfile;
-            scenarios_.push_back(s);
+        std::string_view name;
+        if (!next_number(q, le, bucket) || !next_token(q, le, name) ||
+            !next_number(q, le, map_w) || !next_number(q, le, map_h) ||
+            !next_number(q, le, sx) || !next_number(q, le, sy) ||
+            !next_number(q, le, gx) || !next_number(q, le, gy) ||
+            !next_number(q, le, opt)) continue; // 헤더/깨진 줄
+
+        if (name != last_name || c.names.empty()) {
+            auto [it, fresh] = ids.try_emplace(name, (uint32_t)c.names.size());
+            if (fresh) c.names.push_back(name);
+            last_name = name;
+            last_id = it->second;
+        }
+        c.bucket.push_back(bucket);
+        c.sx.push_back(sx); c.sy.push_back(sy);
+        c.gx.push_back(gx); c.gy.push_back(gy);
+        c.opt.push_back(opt);
+        c.map_id.push_back(last_id);
+    }
+}
+
+template <class T>
+inline void append(std::vector<T>& dst, const std::vector<T>& src) {
+    dst.insert(dst.end(), src.begin(), src.end());
+}
+
+} // namespace
+
+bool ScenarioLoader::load_from_file(const std::string& filepath, unsigned threads) {
+    MappedFile mf;
+    if (!mf.open(filepath)) return false;
+
+    sx_.clear(); sy_.clear(); gx_.clear(); gy_.clear(); bucket_.clear();
+    opt_.clear(); map_id_.clear(); map_names_.clear();
+
+    const char* data = mf.data();
+    const size_t n = mf.size();
+    if (n == 0) return true;
+
+    // 줄 경계 청크: 목표 위치 뒤 첫 '\n' 다음에서 자른다 (작은 파일은 하나로)
+    const size_t kMinChunk = size_t(1) << 20;
+    const size_t parts = std::max<size_t>(1, std::min<size_t>(threads ? threads : 1, n / kMinChunk));
+    std::vector<size_t> cut{ 0 };
+    for (size_t k = 1; k < parts; ++k) {
+        size_t pos = std::max(cut.back(), n * k / parts);
+        const void* nl = pos < n ? std::memchr(data + pos, '\n', n - pos) : nullptr;
+        pos = nl ? (size_t)(static_cast<const char*>(nl) - data) + 1 : n;
+        cut.push_back(pos);
+    }
+    cut.push_back(n);
+
+    std::vector<Chunk> chunks(cut.size() - 1);
+    if (chunks.size() == 1) {
+        parse_range(data, data + n, chunks[0]);
+    } else {
+        ThreadPool pool((unsigned)chunks.size());
+        pool.parallel_for(chunks.size(), /*grain=*/1, [&](unsigned, size_t k) {
+            parse_range(data + cut[k], data + cut[k + 1], chunks[k]);
+        });
+    }
+
+    // 파일 순서대로 병합, 청크 로컬 이름표 → 전역 intern id
+    size_t total = 0;
+    for (auto& c : chunks) total += c.sx.size();
+    sx_.reserve(total); sy_.reserve(total); gx_.reserve(total); gy_.reserve(total);
+    bucket_.reserve(total); opt_.reserve(total); map_id_.reserve(total);
+
+    std::unordered_map<std::string_view, uint32_t> global; // 키는 매핑 버퍼의 view (함수 끝까지 유효)
+    std::vector<uint32_t> remap;
+    for (auto& c : chunks) {
+        remap.resize(c.names.size());
+        for (size_t i = 0; i < c.names.size(); ++i) {
+            auto it = global.find(c.names[i]);
+            if (it == global.end()) {
+                map_names_.emplace_back(c.names[i]);
+                it = global.emplace(c.names[i], (uint32_t)(map_names_.size() - 1)).first;
+            }
+            remap[i] = it->second;
         }
+        append(sx_, c.sx); append(sy_, c.sy); append(gx_, c.gx); append(gy_, c.gy);
+        append(bucket_, c.bucket); append(opt_, c.opt);
+        for (uint32_t id : c.map_id) map_id_.push_back(remap[id]);
     }
     return true;
 }